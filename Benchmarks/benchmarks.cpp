@@ -0,0 +1,3 @@
+#include "benchmarks.hpp"
+
+BENCHMARK_MAIN();
@@ -0,0 +1,910 @@
+#include "date_time.hpp"
+#include "batch.hpp"
+#include "incremental_parser.hpp"
+#include "pattern.hpp"
+#include "format_detector.hpp"
+#include "http_date.hpp"
+#include "log_timestamp.hpp"
+#include "epoch_text.hpp"
+#include "rfc3339.hpp"
+#include "literals.hpp"
+#include "format_pattern.hpp"
+#include "formatter.hpp"
+#include "date_time_now.hpp"
+#include "timestamp_renderer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace legacy {
+
+    /**
+     * \brief Reproduction of the std::string based parsing used before 1.2.0 (copy + substr + std::stoi). Used as a baseline only.
+     */
+    inline auto parseTime(const std::string& time) -> tristan::time::Time {
+        auto l_time = time;
+        auto offset_pos = l_time.find_first_of("-+");
+        auto offset = tristan::TimeZone::UTC;
+        if (offset_pos != std::string::npos && offset_pos == l_time.size() - 3) {
+            offset = static_cast< tristan::TimeZone >(std::stoi(l_time.substr(offset_pos)));
+            l_time.erase(offset_pos);
+        }
+        tristan::time::Time result(static_cast< uint8_t >(std::stoi(l_time.substr(0, 2))),
+                                   static_cast< uint8_t >(std::stoi(l_time.substr(3, 2))),
+                                   static_cast< uint8_t >(std::stoi(l_time.substr(6, 2))),
+                                   static_cast< uint16_t >(std::stoi(l_time.substr(9, 3))),
+                                   static_cast< uint16_t >(std::stoi(l_time.substr(13, 3))),
+                                   static_cast< uint16_t >(std::stoi(l_time.substr(17, 3))));
+        result.setOffset(offset);
+        return result;
+    }
+
+    inline auto parseDate(const std::string& p_iso_date) -> tristan::date::Date {
+        return tristan::date::Date(static_cast< uint8_t >(std::stoi(p_iso_date.substr(8, 2))),
+                                   static_cast< uint8_t >(std::stoi(p_iso_date.substr(5, 2))),
+                                   static_cast< uint16_t >(std::stoi(p_iso_date.substr(0, 4))));
+    }
+
+    inline auto parseDateTime(const std::string& p_date_time) -> tristan::date_time::DateTime {
+        auto delimiter_pos = p_date_time.find('T');
+        tristan::date_time::DateTime result;
+        result.setDate(parseDate(p_date_time.substr(0, delimiter_pos)));
+        result.setTime(parseTime(p_date_time.substr(delimiter_pos + 1)));
+        return result;
+    }
+}  // namespace legacy
+
+namespace {
+    const std::array< std::string, 4 > g_times{"23:23:23.023.023.023+02", "00:00:00.000.000.000-11", "12:34:56.789.012.345+00", "09:08:07.006.005.004+05"};
+    const std::array< std::string, 4 > g_dates{"2021-08-25", "1999-12-30", "2024-02-29", "2001-01-01"};
+    const std::array< std::string, 4 > g_date_times{"2021-08-25T23:23:23.023.023.023+02",
+                                                    "1999-12-30T00:00:00.000.000.000-11",
+                                                    "2024-02-29T12:34:56.789.012.345+00",
+                                                    "2001-01-01T09:08:07.006.005.004+05"};
+}  // namespace
+
+static void Time_Parse_Legacy(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy::parseTime(g_times[index++ & 3]));
+    }
+}
+
+BENCHMARK(Time_Parse_Legacy);
+
+static void Time_Parse_StringView(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::time::Time(std::string_view(g_times[index++ & 3])));
+    }
+}
+
+BENCHMARK(Time_Parse_StringView);
+
+static void Date_Parse_Legacy(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy::parseDate(g_dates[index++ & 3]));
+    }
+}
+
+BENCHMARK(Date_Parse_Legacy);
+
+static void Date_Parse_StringView(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date::Date(std::string_view(g_dates[index++ & 3])));
+    }
+}
+
+BENCHMARK(Date_Parse_StringView);
+
+static void DateTime_Parse_Legacy(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacy::parseDateTime(g_date_times[index++ & 3]));
+    }
+}
+
+BENCHMARK(DateTime_Parse_Legacy);
+
+static void DateTime_Parse_StringView(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::DateTime(std::string_view(g_date_times[index++ & 3])));
+    }
+}
+
+BENCHMARK(DateTime_Parse_StringView);
+
+static void DateTime_Parse_Backend(benchmark::State& state) {
+    const auto backend = static_cast< tristan::date_time::ParserBackend >(state.range(0));
+    if (backend == tristan::date_time::ParserBackend::SIMD && not tristan::date_time::DateTime::simdParserAvailable()) {
+        state.SkipWithError("Library is built without SIMD support (ENABLE_SIMD=OFF)");
+        return;
+    }
+    size_t index = 0;
+    size_t bytes = 0;
+    for (auto _ : state) {
+        const auto& input = g_date_times[index++ & 3];
+        benchmark::DoNotOptimize(tristan::date_time::DateTime::parse(input, backend));
+        bytes += input.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast< int64_t >(bytes));
+}
+
+BENCHMARK(DateTime_Parse_Backend)
+    ->Arg(static_cast< int64_t >(tristan::date_time::ParserBackend::SCALAR))
+    ->Arg(static_cast< int64_t >(tristan::date_time::ParserBackend::SIMD))
+    ->ArgName("backend");
+
+namespace {
+    /**
+     * \brief Every 16th record is malformed.
+     */
+    const std::array< std::string, 16 > g_dirty_date_times{
+        "2021-08-25T23:23:23+02", "2021-08-25T23:23:24+02", "2021-08-25T23:23:25+02", "2021-08-25T23:23:26+02",
+        "2021-08-25T23:23:27+02", "2021-08-25T23:23:28+02", "2021-08-25T23:23:29+02", "2021-08-25T23:23:30+02",
+        "2021-08-25T23:23:31+02", "2021-08-25T23:23:32+02", "2021-08-25T23:23:33+02", "2021-08-25T23:23:34+02",
+        "2021-08-25T23:23:35+02", "2021-08-25T23:23:36+02", "2021-08-25T23:23:37+02", "2021-08-25T23:23:6O+02"};
+}  // namespace
+
+static void DateTime_DirtyFeed_Exceptions(benchmark::State& state) {
+    size_t index = 0;
+    size_t rejected = 0;
+    for (auto _ : state) {
+        try {
+            benchmark::DoNotOptimize(tristan::date_time::DateTime(g_dirty_date_times[index++ & 15]));
+        } catch (const std::invalid_argument&) {
+            ++rejected;
+        }
+    }
+    benchmark::DoNotOptimize(rejected);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_DirtyFeed_Exceptions);
+
+static void DateTime_DirtyFeed_TryParse(benchmark::State& state) {
+    size_t index = 0;
+    size_t rejected = 0;
+    for (auto _ : state) {
+        auto result = tristan::date_time::DateTime::tryParse(g_dirty_date_times[index++ & 15]);
+        rejected += result.hasValue() ? 0 : 1;
+        benchmark::DoNotOptimize(result);
+    }
+    benchmark::DoNotOptimize(rejected);
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_DirtyFeed_TryParse);
+
+static void DateTime_Column_ObjectVector(benchmark::State& state) {
+    std::vector< std::string_view > rows(4096);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i] = g_date_times[i & 3];
+    }
+    for (auto _ : state) {
+        std::vector< tristan::date_time::DateTime > column;
+        column.reserve(rows.size());
+        for (auto row : rows) {
+            column.emplace_back(row);
+        }
+        benchmark::DoNotOptimize(column.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+BENCHMARK(DateTime_Column_ObjectVector);
+
+static void DateTime_Column_ParseBatch(benchmark::State& state) {
+    std::vector< std::string_view > rows(4096);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        rows[i] = g_date_times[i & 3];
+    }
+    std::vector< int64_t > epoch(rows.size());
+    std::vector< uint8_t > validity(rows.size() / 8);
+    tristan::date_time::BatchColumns columns;
+    columns.epoch_nanoseconds = epoch;
+    columns.validity = validity;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::parseBatch(rows, columns));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+
+BENCHMARK(DateTime_Column_ParseBatch);
+
+namespace {
+    /**
+     * \brief Monotonic log like stream: same date, minute changes every 60 records.
+     */
+    auto makeLogStream() -> std::vector< std::string > {
+        std::vector< std::string > l_stream;
+        l_stream.reserve(4096);
+        for (size_t i = 0; i < 4096; ++i) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "2021-08-25T%02zu:%02zu:%02zu.%03zu+02", 10 + i / 3600, (i / 60) % 60, i % 60, (i * 7) % 1000);
+            l_stream.emplace_back(buffer);
+        }
+        return l_stream;
+    }
+}  // namespace
+
+static void DateTime_LogStream_TryParse(benchmark::State& state) {
+    const auto stream = makeLogStream();
+    for (auto _ : state) {
+        for (const auto& record : stream) {
+            benchmark::DoNotOptimize(tristan::date_time::DateTime::tryParse(record));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * stream.size());
+}
+
+BENCHMARK(DateTime_LogStream_TryParse);
+
+static void DateTime_LogStream_IncrementalParser(benchmark::State& state) {
+    const auto stream = makeLogStream();
+    tristan::date_time::IncrementalParser parser;
+    for (auto _ : state) {
+        for (const auto& record : stream) {
+            benchmark::DoNotOptimize(parser.tryParse(record));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * stream.size());
+}
+
+BENCHMARK(DateTime_LogStream_IncrementalParser);
+
+static void DateTime_LogStream_IncrementalSinceEpoch(benchmark::State& state) {
+    const auto stream = makeLogStream();
+    tristan::date_time::IncrementalParser parser;
+    for (auto _ : state) {
+        for (const auto& record : stream) {
+            benchmark::DoNotOptimize(parser.tryParseSinceEpoch(record));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * stream.size());
+}
+
+BENCHMARK(DateTime_LogStream_IncrementalSinceEpoch);
+
+namespace {
+    const std::array< std::string, 4 > g_european_date_times{"25/08/2021 23:23:23", "01/01/1970 00:00:00", "31/12/1999 23:59:59", "29/02/2000 12:00:01"};
+}  // namespace
+
+static void DateTime_European_Substitution(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto& input = g_european_date_times[index++ & 3];
+        std::string iso = input.substr(6, 4) + '-' + input.substr(3, 2) + '-' + input.substr(0, 2) + 'T' + input.substr(11);
+        benchmark::DoNotOptimize(tristan::date_time::DateTime::tryParse(iso));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_European_Substitution);
+
+static void DateTime_European_Pattern(benchmark::State& state) {
+    constexpr tristan::date_time::Pattern pattern("DD/MM/YYYY HH:MM:SS");
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pattern.tryParse(g_european_date_times[index++ & 3]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_European_Pattern);
+
+static void DateTime_European_PatternSinceEpoch(benchmark::State& state) {
+    constexpr tristan::date_time::Pattern pattern("DD/MM/YYYY HH:MM:SS");
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pattern.tryParseSinceEpoch(g_european_date_times[index++ & 3]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_European_PatternSinceEpoch);
+
+namespace {
+    const std::array< std::string, 4 > g_mixed_date_times{"2021-08-25T23:23:23.023Z", "2021-08-25T23:23:24.023Z", "2021-08-25 23:23:25.5", "1629926603.25"};
+}  // namespace
+
+static void DateTime_MixedFeed_ExceptionFallbacks(benchmark::State& state) {
+    size_t index = 0;
+    for (auto _ : state) {
+        const auto& input = g_mixed_date_times[index++ & 3];
+        try {
+            benchmark::DoNotOptimize(tristan::date_time::DateTime(input));
+        } catch (const std::exception&) {
+            benchmark::DoNotOptimize(tristan::date_time::FormatDetector::tryParseAs(input, tristan::date_time::FormatDetector::detect(input)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_MixedFeed_ExceptionFallbacks);
+
+static void DateTime_MixedFeed_FormatDetector(benchmark::State& state) {
+    tristan::date_time::FormatDetector detector;
+    size_t index = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(detector.tryParse(g_mixed_date_times[index++ & 3]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_MixedFeed_FormatDetector);
+
+static void DateTime_HttpDate_Format(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("1994-11-06T08:49:37");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::toHttpDate(date_time));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_HttpDate_Format);
+
+static void DateTime_HttpDate_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseHttpDate("Sun, 06 Nov 1994 08:49:37 GMT"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_HttpDate_Parse);
+
+static void DateTime_HttpDate_NowFormatted(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::toHttpDate(tristan::date_time::DateTime()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_HttpDate_NowFormatted);
+
+static void DateTime_HttpDate_NowCached(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::httpDateNow());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_HttpDate_NowCached)->ThreadRange(1, 4);
+
+static void DateTime_AccessLog_Clf(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseClf("[10/Oct/2000:13:55:36 -0700]"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_AccessLog_Clf);
+
+static void DateTime_AccessLog_ClfSinceEpoch(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseClfSinceEpoch("[10/Oct/2000:13:55:36 -0700]"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_AccessLog_ClfSinceEpoch);
+
+static void DateTime_Syslog_Rfc3164SinceEpoch(benchmark::State& state) {
+    const tristan::date::Date reference("2021-01-05");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseRfc3164SinceEpoch("Oct 11 22:14:15", reference));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Syslog_Rfc3164SinceEpoch);
+
+static void DateTime_Syslog_Rfc5424(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseRfc5424("2003-10-11T22:14:15.003Z"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Syslog_Rfc5424);
+
+static void DateTime_EpochText_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseEpoch("1697040000.123456789"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_EpochText_Parse);
+
+static void DateTime_EpochText_ParseSinceEpoch(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseEpochSinceEpoch("1697040000.123456789"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_EpochText_ParseSinceEpoch);
+
+static void DateTime_EpochText_Format(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2023-10-11T16:00:00.123.456.789");
+    std::array< char, tristan::date_time::g_epoch_text_max_length > buffer{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::writeEpoch(date_time, tristan::date_time::EpochUnit::SECONDS, 9, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_EpochText_Format);
+
+static void DateTime_Rfc3339_Parse(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::tryParseRfc3339("2021-08-25T23:23:23.123456+05:30"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Rfc3339_Parse);
+
+static void DateTime_Rfc3339_Format(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2021-08-25T23:23:23.123.456+02");
+    std::array< char, tristan::date_time::g_rfc3339_max_length > buffer{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::writeRfc3339(date_time, buffer));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Rfc3339_Format);
+
+namespace {
+    auto makeDayColumn() -> std::vector< int32_t > {
+        std::vector< int32_t > days(4096);
+        for (size_t index = 0; index < days.size(); ++index) {
+            days[index] = static_cast< int32_t >(18000 + index * 7 % 3650);
+        }
+        return days;
+    }
+}  // namespace
+
+static void Date_IsoWeek_DayByDayLoop(benchmark::State& state) {
+    const auto days = makeDayColumn();
+    std::vector< uint8_t > weeks(days.size());
+    for (auto _ : state) {
+        for (size_t index = 0; index < days.size(); ++index) {
+            // Week number derived by walking from January 1st, as callers had to do before isoWeek().
+            auto date = *tristan::date::Date::fromDaysSinceEpoch(days[index]);
+            auto day = *tristan::date::Date::fromDaysSinceEpoch(days[index] - date.dayOfTheYear() + 1);
+            uint16_t mondays = (day.dayOfTheWeek() + 6) % 7 <= 3 ? 1 : 0;
+            for (; day < date; day.addDays(1)) {
+                mondays += day.dayOfTheWeek() == 0 ? 1 : 0;
+            }
+            weeks[index] = static_cast< uint8_t >(mondays);
+        }
+        benchmark::DoNotOptimize(weeks.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(days.size()));
+}
+
+BENCHMARK(Date_IsoWeek_DayByDayLoop);
+
+static void Date_IsoWeek_Batch(benchmark::State& state) {
+    const auto days = makeDayColumn();
+    std::vector< uint16_t > week_years(days.size());
+    std::vector< uint8_t > weeks(days.size());
+    for (auto _ : state) {
+        tristan::date_time::isoWeekBatch(days, week_years, weeks);
+        benchmark::DoNotOptimize(weeks.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(days.size()));
+}
+
+BENCHMARK(Date_IsoWeek_Batch);
+
+static void Time_Constant_StringConstructor(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::time::Time("09:30:00"));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Time_Constant_StringConstructor);
+
+static void Time_Constant_Literal(benchmark::State& state) {
+    using namespace tristan::literals;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::time::Time("09:30:00"_time));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Time_Constant_Literal);
+
+static void DateTime_Stream_StringExtraction(benchmark::State& state) {
+    std::istringstream input;
+    std::string text;
+    for (auto _ : state) {
+        input.clear();
+        input.str("2024-01-31T09:30:00.123+02");
+        input >> text;
+        benchmark::DoNotOptimize(tristan::date_time::DateTime(text));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Stream_StringExtraction);
+
+static void DateTime_Stream_Extraction(benchmark::State& state) {
+    std::istringstream input;
+    tristan::date_time::DateTime date_time;
+    for (auto _ : state) {
+        input.clear();
+        input.str("2024-01-31T09:30:00.123+02");
+        input >> date_time;
+        benchmark::DoNotOptimize(date_time);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Stream_Extraction);
+
+static void DateTime_Format_ToString(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date_time.toString());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Format_ToString);
+
+static void DateTime_Format_ToChars(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    std::array< char, tristan::date_time::g_date_time_max_length > buffer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date_time.toChars(buffer.data(), buffer.data() + buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Format_ToChars);
+
+static void DateTime_Format_AppendTo(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    std::string line;
+    line.reserve(64);
+    for (auto _ : state) {
+        line.clear();
+        date_time.appendTo(line);
+        benchmark::DoNotOptimize(line.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Format_AppendTo);
+
+static void DateTime_Format_FixedString(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date_time.toFixedString());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Format_FixedString);
+
+static void DateTime_CustomFormat_Lambda(benchmark::State& state) {
+    tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    date_time.setLocalFormatter([](const tristan::date_time::DateTime& p_date_time) {
+        auto l_two_digits = [](std::string& p_string, uint32_t p_value) {
+            p_string += static_cast< char >('0' + p_value / 10);
+            p_string += static_cast< char >('0' + p_value % 10);
+        };
+        const auto& l_date = p_date_time.date();
+        const auto& l_time = p_date_time.time();
+        std::string l_result = std::to_string(l_date.year());
+        l_two_digits(l_result, l_date.month());
+        l_two_digits(l_result, l_date.dayOfTheMonth());
+        l_result += ' ';
+        l_two_digits(l_result, l_time.hours());
+        l_result += ':';
+        l_two_digits(l_result, l_time.minutes());
+        l_result += ':';
+        l_two_digits(l_result, l_time.seconds());
+        l_result += '.';
+        auto l_fraction = std::to_string(l_time.milliseconds() * 1000 + l_time.microseconds());
+        l_result.append(6 - l_fraction.size(), '0');
+        l_result += l_fraction;
+        return l_result;
+    });
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date_time.toString());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_CustomFormat_Lambda);
+
+static void DateTime_CustomFormat_Pattern(benchmark::State& state) {
+    static constexpr tristan::date_time::FormatPattern pattern("%Y%m%d %H:%M:%S.%f");
+    tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    date_time.setLocalFormatter(pattern.toFormatter());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date_time.toString());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_CustomFormat_Pattern);
+
+static void DateTime_FormatSpec_FormatTo(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    const tristan::date_time::FormatSpec spec(".3");
+    std::array< char, 64 > buffer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(spec.formatTo(date_time, buffer.data()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_FormatSpec_FormatTo);
+
+#if defined(__cpp_lib_format)
+static void DateTime_StdFormat_FormatTo(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    std::array< char, 64 > buffer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::format_to_n(buffer.data(), buffer.size(), "{}", date_time));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_StdFormat_FormatTo);
+#endif
+
+namespace {
+    auto makeDateTimeColumn() -> std::vector< tristan::date_time::DateTime > {
+        std::vector< tristan::date_time::DateTime > values;
+        values.reserve(4096);
+        for (int64_t index = 0; index < 4096; ++index) {
+            values.push_back(*tristan::date_time::DateTime::fromSinceEpoch(std::chrono::nanoseconds(1700000000123456789 + index * 7919000000123),
+                                                                          tristan::time::Precision::MILLISECONDS));
+        }
+        return values;
+    }
+}  // namespace
+
+static void DateTime_Export_ToStringLoop(benchmark::State& state) {
+    const auto values = makeDateTimeColumn();
+    std::string buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        for (const auto& value: values) {
+            buffer += value.toString();
+            buffer += '\n';
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(values.size()));
+}
+
+BENCHMARK(DateTime_Export_ToStringLoop);
+
+static void DateTime_Export_FormatBatch(benchmark::State& state) {
+    const auto values = makeDateTimeColumn();
+    std::string buffer(
+        tristan::date_time::batchBufferSize(values.size(), tristan::date_time::BatchFormat::DATE_TIME, tristan::time::Precision::MILLISECONDS, "\n"), ' ');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::formatBatch(values, tristan::time::Precision::MILLISECONDS, buffer, "\n"));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(values.size()));
+}
+
+BENCHMARK(DateTime_Export_FormatBatch);
+
+static void DateTime_Export_FormatBatchTicks(benchmark::State& state) {
+    std::vector< int64_t > ticks(4096);
+    for (size_t index = 0; index < ticks.size(); ++index) {
+        ticks[index] = 1700000000123456789 + static_cast< int64_t >(index) * 7919000000123;
+    }
+    std::string buffer(
+        tristan::date_time::batchBufferSize(ticks.size(), tristan::date_time::BatchFormat::DATE_TIME, tristan::time::Precision::MILLISECONDS, "\n"), ' ');
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::formatBatch(std::span< const int64_t >(ticks), tristan::time::Precision::MILLISECONDS, buffer, "\n"));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(ticks.size()));
+}
+
+BENCHMARK(DateTime_Export_FormatBatchTicks);
+
+static void DateTime_Now_LocalDateTimeToString(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::DateTime::localDateTime().toString());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Now_LocalDateTimeToString);
+
+static void DateTime_Now_ClockRead(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::chrono::system_clock::now());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Now_ClockRead);
+
+static void DateTime_Now_LocalCached(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::localDateTimeNow(tristan::time::Precision::MILLISECONDS));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Now_LocalCached)->ThreadRange(1, 4);
+
+static void DateTime_Now_UtcCachedWrite(benchmark::State& state) {
+    std::array< char, tristan::date_time::g_date_time_max_length > buffer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::writeUtcDateTimeNow(buffer.data(), buffer.data() + buffer.size(), tristan::time::Precision::MICROSECONDS));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Now_UtcCachedWrite);
+
+static void Date_Format_TextTable(benchmark::State& state) {
+    tristan::date::Date::setTextTableEnabled(state.range(0) != 0);
+    std::vector< tristan::date::Date > dates;
+    for (int64_t day = 0; day < 4096; ++day) {
+        dates.push_back(tristan::date::Date::fromDaysSinceEpoch(10957 + day * 37 % 11000).value());
+    }
+    std::array< char, tristan::date::g_date_max_length > buffer;
+    for (auto _ : state) {
+        for (const auto& date: dates) {
+            benchmark::DoNotOptimize(date.toChars(buffer.data(), buffer.data() + buffer.size()));
+            benchmark::ClobberMemory();
+        }
+    }
+    tristan::date::Date::setTextTableEnabled(false);
+    state.SetItemsProcessed(state.iterations() * static_cast< int64_t >(dates.size()));
+}
+
+BENCHMARK(Date_Format_TextTable)->Arg(0)->Arg(1);
+
+static void DateTime_Format_GlobalFormatterThreads(benchmark::State& state) {
+    static constexpr tristan::date_time::FormatPattern pattern("%Y%m%d %H:%M:%S.%f");
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    if (state.thread_index() == 0) {
+        tristan::date_time::DateTime::setGlobalFormatter(pattern.toFormatter());
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(date_time.toString());
+    }
+    if (state.thread_index() == 0) {
+        tristan::date_time::DateTime::setGlobalFormatter({});
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Format_GlobalFormatterThreads)->ThreadRange(1, 8)->UseRealTime();
+
+static void DateTime_Stream_ToStringInsertion(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    std::ostringstream output;
+    for (auto _ : state) {
+        output.seekp(0);
+        output << date_time.toString();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Stream_ToStringInsertion);
+
+static void DateTime_Stream_Insertion(benchmark::State& state) {
+    const tristan::date_time::DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    std::ostringstream output;
+    for (auto _ : state) {
+        output.seekp(0);
+        output << date_time;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Stream_Insertion);
+
+static void DateTime_Capture_Now(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tristan::date_time::CapturedTime::now());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DateTime_Capture_Now);
+
+static void DateTime_Capture_Renderer(benchmark::State& state) {
+    std::atomic< size_t > rendered{0};
+    tristan::date_time::TimestampRenderer renderer(
+        [&rendered](const tristan::date_time::RenderedBatch& batch) {
+            rendered.fetch_add(batch.size(), std::memory_order_relaxed);
+        },
+        tristan::date_time::FormatSpec(".6"));
+    size_t dropped = 0;
+    for (auto _ : state) {
+        if (not renderer.capture()) {
+            ++dropped;
+        }
+    }
+    renderer.stop();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["dropped"] = static_cast< double >(dropped);
+    state.counters["rendered"] = static_cast< double >(rendered.load());
+}
+
+BENCHMARK(DateTime_Capture_Renderer);
+
+static void Date_NamedFormat_PutTime(benchmark::State& state) {
+    const tristan::date::Date date("2026-10-17");
+    std::ostringstream output;
+    for (auto _ : state) {
+        std::tm tm{};
+        tm.tm_year = date.year() - 1900;
+        tm.tm_mon = date.month() - 1;
+        tm.tm_mday = date.dayOfTheMonth();
+        tm.tm_wday = date.dayOfTheWeek();
+        output.seekp(0);
+        output << std::put_time(&tm, "%A %d %B %Y");
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Date_NamedFormat_PutTime);
+
+static void Date_NamedFormat_Numeric(benchmark::State& state) {
+    static constexpr tristan::date_time::FormatPattern pattern("%d.%m.%Y");
+    const tristan::date::Date date("2026-10-17");
+    std::array< char, tristan::date_time::FormatPattern::max_length > buffer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pattern.write(date, buffer.data(), buffer.data() + buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Date_NamedFormat_Numeric);
+
+static void Date_NamedFormat_Localized(benchmark::State& state) {
+    static constexpr tristan::date_time::FormatPattern pattern("%A %d %B %Y", tristan::date_time::Locale::FRENCH);
+    const tristan::date::Date date("2026-10-17");
+    std::array< char, tristan::date_time::FormatPattern::max_length > buffer;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pattern.write(date, buffer.data(), buffer.data() + buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(Date_NamedFormat_Localized);
@@ -1,6 +1,25 @@
 #include "date_time.hpp"
+#include "batch.hpp"
+#include "incremental_parser.hpp"
+#include "pattern.hpp"
+#include "format_detector.hpp"
+#include "http_date.hpp"
+#include "log_timestamp.hpp"
+#include "epoch_text.hpp"
+#include "rfc3339.hpp"
+#include "literals.hpp"
+#include "format_pattern.hpp"
+#include "formatter.hpp"
+#include "date_time_now.hpp"
+#include "timestamp_renderer.hpp"
 
 #include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <vector>
 using namespace tristan;
 using namespace tristan::time;
 using namespace tristan::date;
@@ -87,6 +106,38 @@ TEST(Time, String_constructor) {
     EXPECT_THROW(Time{invalid_time3}, std::invalid_argument) << "Exception on invalid_time3 range expected";
 }
 
+TEST(Time, StringView_constructor) {
+    const char* buffer = "ts=23:23:23.023.023.023-05;";
+    Time time(std::string_view(buffer + 3, 23));
+
+    ASSERT_EQ(time.hours(), 23) << "Hours are not equal";
+    ASSERT_EQ(time.nanoseconds(), 23) << "Nanoseconds are not equal";
+    ASSERT_EQ(time.precision(), Precision::NANOSECONDS);
+    ASSERT_EQ(time.offset(), TimeZone::WEST_5);
+
+    ASSERT_EQ(Time(std::string_view(buffer + 3, 5)), Time(23, 23));
+    EXPECT_THROW(Time{std::string_view(buffer + 3, 6)}, std::invalid_argument);
+    EXPECT_THROW(Time{"23:23+1a"}, std::invalid_argument);
+    EXPECT_THROW(Time{"23:23+13"}, std::range_error);
+    EXPECT_THROW(Time{"24:23"}, std::range_error);
+}
+
+TEST(Time, TryParse) {
+    auto time = Time::tryParse("23:23:23.023+02");
+    ASSERT_TRUE(time);
+    ASSERT_EQ(time->milliseconds(), 23);
+    ASSERT_EQ(time->precision(), Precision::MILLISECONDS);
+    ASSERT_EQ(time->offset(), TimeZone::EAST_2);
+
+    ASSERT_EQ(Time::tryParse("2a:23").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(Time::tryParse("23:23:23.0230").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(Time::tryParse("23:60").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Time::tryParse("23:59+14").error(), ErrorCode::OUT_OF_RANGE);
+
+    ASSERT_EQ(Time::tryCreate(Precision::SECONDS, 23, 23, 23).value(), Time(23, 23, 23));
+    ASSERT_EQ(Time::tryCreate(Precision::SECONDS, 23, 23, 60).error(), ErrorCode::OUT_OF_RANGE);
+}
+
 TEST(Time, AddHours) {
     Time time(21, 23);
 
@@ -354,10 +405,28 @@ TEST(Date, ExplicitConstructor) {
     EXPECT_THROW(Date(32, 8, 2021), std::range_error);
     EXPECT_THROW(Date(30, 13, 2021), std::range_error);
     EXPECT_THROW(Date(1, 1, 1899), std::range_error);
+    EXPECT_THROW(Date(1, 1, 2156), std::range_error);
     EXPECT_THROW(Date(30, 2, 2021), std::range_error);
     EXPECT_THROW(Date(31, 6, 2021), std::range_error);
 }
 
+TEST(Date, RoundTripFullRange) {
+    const std::array< uint8_t, 12 > days_in_month{31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int64_t days_since_epoch = -25567;  // 1900-01-01
+    for (uint16_t year = 1900; year <= 2155; ++year) {
+        for (uint8_t month = 1; month <= 12; ++month) {
+            const uint8_t last_day = month == 2 && Date::isLeapYear(year) ? 29 : days_in_month[month - 1];
+            for (uint8_t day = 1; day <= last_day; ++day) {
+                Date date(day, month, year);
+                ASSERT_EQ(date.year(), year) << +day << '.' << +month << '.' << year;
+                ASSERT_EQ(date.month(), month) << +day << '.' << +month << '.' << year;
+                ASSERT_EQ(date.dayOfTheMonth(), day) << +day << '.' << +month << '.' << year;
+                ASSERT_EQ(date.daysSinceEpoch(), days_since_epoch++) << +day << '.' << +month << '.' << year;
+            }
+        }
+    }
+}
+
 TEST(Date, StringConstructor) {
     Date date("2021-08-25");
 
@@ -377,6 +446,32 @@ TEST(Date, StringConstructor) {
     EXPECT_THROW(Date{invalid_date3}, std::invalid_argument);
 }
 
+TEST(Date, StringViewConstructor) {
+    std::string buffer = "2021-08-25T10:10";
+    Date date(std::string_view(buffer).substr(0, 10));
+
+    ASSERT_EQ(date, Date(25, 8, 2021));
+    ASSERT_EQ(Date("20210825"), Date(25, 8, 2021));
+
+    EXPECT_THROW(Date{"2021-08-2a"}, std::invalid_argument);
+    EXPECT_THROW(Date{"202108-025"}, std::invalid_argument);
+    EXPECT_THROW(Date{"2021-02-30"}, std::range_error);
+}
+
+TEST(Date, TryParse) {
+    auto date = Date::tryParse("2024-02-29");
+    ASSERT_TRUE(date.hasValue());
+    ASSERT_EQ(*date, Date(29, 2, 2024));
+
+    ASSERT_EQ(Date::tryParse("2024-2-29").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(Date::tryParse("2023-02-29").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParse("18991231").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryCreate(31, 4, 2021).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryCreate(30, 4, 2021).value(), Date(30, 4, 2021));
+    ASSERT_EQ(Date::tryCreate(31, 12, 2155).value().daysSinceEpoch(), 67934);
+    ASSERT_EQ(Date::tryCreate(1, 1, 2156).error(), ErrorCode::OUT_OF_RANGE);
+}
+
 TEST(Date, OperatorEqual) {
     Date date_one("2021-08-25");
     Date date_two(25, 8, 2021);
@@ -589,6 +684,74 @@ TEST(DateTime, StringConstructor) {
     ASSERT_EQ(d_date.time().offset(), TimeZone::EAST_2);
 }
 
+TEST(DateTime, StringViewConstructor) {
+    std::string line = "[2021-08-25T23:23:23.023+02] message";
+
+    DateTime d_date(std::string_view(line).substr(1, 26));
+
+    ASSERT_EQ(d_date.date(), Date(25, 8, 2021));
+    ASSERT_EQ(d_date.time().milliseconds(), 23);
+    ASSERT_EQ(d_date.time().precision(), Precision::MILLISECONDS);
+    ASSERT_EQ(d_date.time().offset(), TimeZone::EAST_2);
+
+    EXPECT_THROW(DateTime{"2021-08-25 23:23:23"}, std::runtime_error);
+}
+
+TEST(DateTime, ParserBackendsEquality) {
+    const std::vector< std::string > inputs{"20210101T10:10+02",
+                                            "2021-01-01T10:10",
+                                            "2021-08-25T23:23:23",
+                                            "2021-08-25T23:23:23-11",
+                                            "20240229T23:59:59.999",
+                                            "2024-02-29T00:00:00.001.002+12",
+                                            "2024-02-29T12:34:56.789.012.345-05",
+                                            "20240229T12:34:56.789.012.345+05",
+                                            "2021-08-25T23:23:23+13",
+                                            "2021-02-29T23:23:23",
+                                            "2021-08-25T24:23:23",
+                                            "2021-08-25T23:23:23.1000",
+                                            "2021-08-25T23:23:23.100.",
+                                            "2021-08-25T23:23:23.a00",
+                                            "2021-08-25t23:23:23",
+                                            "2021-08-25 23:23:23",
+                                            "2021/08/25T23:23:23",
+                                            "2021-0825T23:23:23",
+                                            "2021-08-25T23:23:23+2",
+                                            ""};
+    auto outcome = [](const std::string& input, ParserBackend backend) -> std::string {
+        try {
+            auto date_time = DateTime::parse(input, backend);
+            return date_time.date().toString() + '|' + std::to_string(date_time.time().hours()) + ':' + std::to_string(date_time.time().minutes()) + ':'
+                 + std::to_string(date_time.time().seconds()) + '.' + std::to_string(date_time.time().milliseconds()) + '.'
+                 + std::to_string(date_time.time().microseconds()) + '.' + std::to_string(date_time.time().nanoseconds()) + '|'
+                 + std::to_string(static_cast< int >(date_time.time().precision())) + '|' + std::to_string(static_cast< int >(date_time.time().offset()));
+        } catch (const std::range_error&) {
+            return "range_error";
+        } catch (const std::invalid_argument&) {
+            return "invalid_argument";
+        } catch (const std::runtime_error&) {
+            return "runtime_error";
+        }
+    };
+    for (const auto& input: inputs) {
+        EXPECT_EQ(outcome(input, ParserBackend::SCALAR), outcome(input, ParserBackend::SIMD)) << input;
+    }
+    EXPECT_EQ(outcome(inputs[6], ParserBackend::SIMD), "2024-02-29|12:34:56.789.12.345|4|-5");
+}
+
+TEST(DateTime, TryParse) {
+    for (auto backend: {ParserBackend::SCALAR, ParserBackend::SIMD}) {
+        auto date_time = DateTime::tryParse("2021-08-25T23:23:23-03", backend);
+        ASSERT_TRUE(date_time);
+        ASSERT_EQ(date_time->date(), Date(25, 8, 2021));
+        ASSERT_EQ(date_time->time().offset(), TimeZone::WEST_3);
+
+        ASSERT_EQ(DateTime::tryParse("2021-08-25 23:23:23", backend).error(), ErrorCode::MISSING_DELIMITER);
+        ASSERT_EQ(DateTime::tryParse("2021-08-32T23:23:23", backend).error(), ErrorCode::OUT_OF_RANGE);
+        ASSERT_EQ(DateTime::tryParse("2021-08-25T23:23:3", backend).error(), ErrorCode::INVALID_FORMAT);
+    }
+}
+
 TEST(DateTime, AddSeconds_55){
     std::string date = "20210101T23:59:10+02";
 
@@ -851,4 +1014,988 @@ TEST(DateTime, SubtractHours_48){
     ASSERT_EQ(l_date_time.time().hours(), 0);
     ASSERT_EQ(l_date_time.time().minutes(), 10);
     ASSERT_EQ(l_date_time.time().seconds(), 10);
-}
\ No newline at end of file
+}
+
+TEST(DateTime, SinceEpoch){
+    ASSERT_EQ(DateTime("1970-01-01T00:00:00").sinceEpoch().count(), 0);
+    ASSERT_EQ(std::chrono::duration_cast< std::chrono::seconds >(DateTime("2021-08-25T23:23:23+02").sinceEpoch()).count(), 1629926603);
+    ASSERT_EQ(DateTime("1999-12-31T23:59:59.000.000.001").sinceEpoch().count(), 946684799000000001);
+}
+
+TEST(Batch, ParseMatchesRowByRow){
+    std::vector< std::string_view > rows{"2021-08-25T23:23:23+02",
+                                         "20210825T23:23:23.123.456.789",
+                                         "2021-02-29T10:00:00",
+                                         "2021-08-25 23:23:23",
+                                         "1970-01-01T00:00-05",
+                                         "",
+                                         "2000-02-29T12:00:00.500",
+                                         "2021-13-01T00:00:00",
+                                         "1999-12-31T23:59:59.000.001"};
+    std::vector< int64_t > epoch(rows.size());
+    std::vector< int32_t > days(rows.size());
+    std::vector< int64_t > time_of_day(rows.size());
+    std::vector< int8_t > offsets(rows.size());
+    std::vector< uint8_t > validity(2, 0xFF);
+    BatchColumns columns{epoch, days, time_of_day, offsets, validity};
+
+    ASSERT_EQ(parseBatch(rows, columns), 5);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        auto row = DateTime::tryParse(rows[i]);
+        ASSERT_EQ(static_cast< bool >(validity[i / 8] & (1U << (i % 8))), row.hasValue()) << rows[i];
+        if (row) {
+            ASSERT_EQ(epoch[i], row->sinceEpoch().count()) << rows[i];
+            ASSERT_EQ(days[i], row->date().daysSinceEpoch()) << rows[i];
+            ASSERT_EQ(time_of_day[i], row->time().sinceDayStart().count()) << rows[i];
+            ASSERT_EQ(offsets[i], static_cast< int8_t >(row->time().offset())) << rows[i];
+        } else {
+            ASSERT_EQ(epoch[i], 0);
+            ASSERT_EQ(days[i], 0);
+        }
+    }
+    ASSERT_EQ(validity[1] & 0xFE, 0);
+}
+
+TEST(Batch, ParseBufferWithOffsets){
+    std::string buffer = "2021-08-25T23:23:23+02invalid1970-01-01T00:00:01";
+    std::vector< uint32_t > offsets{0, 22, 29, 48};
+    std::vector< int64_t > epoch(3);
+    std::vector< uint8_t > validity(1);
+    BatchColumns columns;
+    columns.epoch_nanoseconds = epoch;
+    columns.validity = validity;
+
+    ASSERT_EQ(parseBatch(buffer, offsets, columns, ParserBackend::SCALAR), 2);
+    ASSERT_EQ(validity[0], 0b101);
+    ASSERT_EQ(epoch[0], DateTime("2021-08-25T23:23:23+02").sinceEpoch().count());
+    ASSERT_EQ(epoch[1], 0);
+    ASSERT_EQ(epoch[2], 1000000000);
+
+    std::vector< uint32_t > bad_offsets{0, 22, 60};
+    ASSERT_THROW(parseBatch(buffer, bad_offsets, columns), std::invalid_argument);
+    std::vector< int64_t > small(1);
+    columns.epoch_nanoseconds = small;
+    ASSERT_THROW(parseBatch(buffer, offsets, columns), std::invalid_argument);
+}
+
+TEST(IncrementalParser, MatchesStatelessParser){
+    std::vector< std::string_view > records{"2021-08-25T23:23:23+02",
+                                            "2021-08-25T23:23:24+02",
+                                            "2021-08-25T23:23:25.123",
+                                            "2021-08-25T23:23:60",
+                                            "2021-08-25T23:23:2a",
+                                            "2021-08-25T23:23:26.123.456.789-05",
+                                            "2021-08-25T23:23+13",
+                                            "2021-08-25T23:23",
+                                            "2021-08-25T23:24:00",
+                                            "2021-08-25T24:00:00",
+                                            "2021-08-25T",
+                                            "2021-08-26T00:00:00",
+                                            "20210826T00:00:01",
+                                            "20210826T00:00:02.5",
+                                            "2021-02-29T00:00:00",
+                                            "2021-08-26 00:00:03",
+                                            "20210826T00:00:04"};
+    IncrementalParser parser;
+    for (auto record: records) {
+        auto expected = DateTime::tryParse(record);
+        auto result = parser.tryParse(record);
+        ASSERT_EQ(result.hasValue(), expected.hasValue()) << record;
+        if (expected) {
+            ASSERT_EQ(*result, *expected) << record;
+            ASSERT_EQ(result->time().offset(), expected->time().offset()) << record;
+            ASSERT_EQ(result->toString(), expected->toString()) << record;
+        } else {
+            ASSERT_EQ(result.error(), expected.error()) << record;
+        }
+    }
+}
+
+TEST(IncrementalParser, Reset){
+    IncrementalParser parser(ParserBackend::SCALAR);
+    ASSERT_EQ(parser.parse("2021-08-25T23:23:23").sinceEpoch(), DateTime("2021-08-25T23:23:23").sinceEpoch());
+    parser.reset();
+    ASSERT_EQ(parser.parse("2021-08-25T23:23:24").sinceEpoch(), DateTime("2021-08-25T23:23:24").sinceEpoch());
+    ASSERT_THROW(static_cast< void >(parser.parse("2021-08-25T23:23:61")), std::range_error);
+}
+
+TEST(IncrementalParser, SinceEpoch){
+    std::vector< std::string_view > records{"2021-08-25T23:23:23+02",
+                                            "2021-08-25T23:23:24.001-03",
+                                            "2021-08-25T23:23:60",
+                                            "2021-08-25T23:23:25.001.002.003",
+                                            "2021-08-25T23:24",
+                                            "2021-08-25T23:24:01+00",
+                                            "2021-08-26T00:00:00"};
+    IncrementalParser parser;
+    for (auto record: records) {
+        auto expected = DateTime::tryParse(record);
+        auto result = parser.tryParseSinceEpoch(record);
+        ASSERT_EQ(result.hasValue(), expected.hasValue()) << record;
+        if (expected) {
+            ASSERT_EQ(*result, expected->sinceEpoch()) << record;
+        } else {
+            ASSERT_EQ(result.error(), expected.error()) << record;
+        }
+    }
+}
+
+TEST(Pattern, Parse){
+    constexpr Pattern european("DD/MM/YYYY HH:MM:SS");
+    static_assert(european.length() == 19);
+    static_assert(european.precision() == Precision::SECONDS);
+    ASSERT_EQ(european.parse("25/08/2021 23:23:23"), DateTime("2021-08-25T23:23:23"));
+
+    constexpr Pattern compact("YYYYMMDD-HHMMSS");
+    ASSERT_EQ(compact.parse("20210825-232324"), DateTime("2021-08-25T23:23:24"));
+
+    Pattern fraction("YYYY-MM-DD HH:MM:SS.ffffffZ");
+    auto date_time = fraction.parse("2021-08-25 23:23:23.123456-05");
+    ASSERT_EQ(date_time, DateTime("2021-08-25T23:23:23.123.456-05"));
+    ASSERT_EQ(date_time.time().offset(), TimeZone::WEST_5);
+    ASSERT_EQ(*fraction.tryParseSinceEpoch("2021-08-25 23:23:23.123456-05"), date_time.sinceEpoch());
+
+    Pattern date_only("MM/DD/YYYY");
+    ASSERT_EQ(date_only.parse("08/25/2021"), DateTime("2021-08-25T00:00"));
+}
+
+TEST(Pattern, Errors){
+    Pattern pattern("DD/MM/YYYY HH:MM:SS");
+    ASSERT_EQ(pattern.tryParse("25/08/2021 23:23").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(pattern.tryParse("25-08-2021 23:23:23").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(pattern.tryParse("25/08/2021 23:2a:23").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(pattern.tryParse("29/02/2021 23:23:23").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(pattern.tryParseSinceEpoch("25/08/2021 24:00:00").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_THROW(static_cast< void >(pattern.parse("25/08/2021 23:60:00")), std::range_error);
+
+    ASSERT_THROW(Pattern("DD/MM/YY"), std::invalid_argument);
+    ASSERT_THROW(Pattern("DD/MM HH:MM"), std::invalid_argument);
+    ASSERT_THROW(Pattern("YYYY-MM-DD SS"), std::invalid_argument);
+    ASSERT_THROW(Pattern("YYYY-MM-DD HH:MM:SS.ffff"), std::invalid_argument);
+    ASSERT_THROW(Pattern("YYYY-MM-DD-DD"), std::invalid_argument);
+}
+
+TEST(FormatDetector, Detect){
+    ASSERT_EQ(FormatDetector::detect("20210825T23:23:23"), TimestampFormat::ISO_BASIC);
+    ASSERT_EQ(FormatDetector::detect("2021-08-25T23:23:23.023+02"), TimestampFormat::ISO_EXTENDED);
+    ASSERT_EQ(FormatDetector::detect("2021-08-25 23:23:23.5"), TimestampFormat::SQL);
+    ASSERT_EQ(FormatDetector::detect("2021-08-25T23:23:23.123456Z"), TimestampFormat::RFC_3339);
+    ASSERT_EQ(FormatDetector::detect("2021-08-25T23:23:23+05:30"), TimestampFormat::RFC_3339);
+    ASSERT_EQ(FormatDetector::detect("1629926603.5"), TimestampFormat::EPOCH_SECONDS);
+    ASSERT_EQ(FormatDetector::detect("Wed, 25 Aug 2021"), TimestampFormat::UNKNOWN);
+}
+
+TEST(FormatDetector, ParseAs){
+    auto reference = DateTime("2021-08-25T21:23:23").sinceEpoch();
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-25T23:23:23+02", TimestampFormat::ISO_EXTENDED)->sinceEpoch(), reference);
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-25 21:23:23", TimestampFormat::SQL)->sinceEpoch(), reference);
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-25T21:23:23Z", TimestampFormat::RFC_3339)->sinceEpoch(), reference);
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-26T02:53:23+05:30", TimestampFormat::RFC_3339)->sinceEpoch(), reference);
+    ASSERT_EQ(FormatDetector::tryParseAs("1629926603", TimestampFormat::EPOCH_SECONDS)->sinceEpoch(), reference);
+
+    auto with_offset = FormatDetector::tryParseAs("2021-08-25T23:23:23.12-02:00", TimestampFormat::RFC_3339);
+    ASSERT_EQ(with_offset->time().offset(), TimeZone::WEST_2);
+    ASSERT_EQ(with_offset->time().precision(), Precision::MILLISECONDS);
+    ASSERT_EQ(with_offset->time().milliseconds(), 120);
+
+    auto epoch = FormatDetector::tryParseAs("-1.000001", TimestampFormat::EPOCH_SECONDS);
+    ASSERT_EQ(epoch->sinceEpoch().count(), -1000001000);
+    ASSERT_EQ(epoch->time().precision(), Precision::MICROSECONDS);
+
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-25 21:23:60", TimestampFormat::SQL).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-25T21:23:23+05:60", TimestampFormat::RFC_3339).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(FormatDetector::tryParseAs("2021-08-25T21:23:23.1234567890Z", TimestampFormat::RFC_3339).error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(FormatDetector::tryParseAs("1629926603.", TimestampFormat::EPOCH_SECONDS).error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(FormatDetector::tryParseAs("99999999999999999999", TimestampFormat::EPOCH_SECONDS).error(), ErrorCode::OUT_OF_RANGE);
+}
+
+TEST(FormatDetector, RemembersLastFormat){
+    FormatDetector detector;
+    ASSERT_EQ(detector.lastFormat(), TimestampFormat::UNKNOWN);
+    ASSERT_TRUE(detector.tryParse("2021-08-25 21:23:23"));
+    ASSERT_EQ(detector.lastFormat(), TimestampFormat::SQL);
+    ASSERT_EQ(detector.tryParse("2021-08-25 21:23:61").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(detector.lastFormat(), TimestampFormat::SQL);
+    ASSERT_EQ(detector.parse("1629926603").sinceEpoch(), DateTime("2021-08-25T21:23:23").sinceEpoch());
+    ASSERT_EQ(detector.lastFormat(), TimestampFormat::EPOCH_SECONDS);
+    ASSERT_THROW(static_cast< void >(detector.parse("yesterday")), std::invalid_argument);
+    ASSERT_EQ(detector.lastFormat(), TimestampFormat::EPOCH_SECONDS);
+}
+
+TEST(DateTime, FromSinceEpoch){
+    auto date_time = DateTime::fromSinceEpoch(DateTime("2021-08-25T23:23:23.123+02").sinceEpoch(), Precision::MILLISECONDS, TimeZone::EAST_2);
+    ASSERT_EQ(*date_time, DateTime("2021-08-25T23:23:23.123+02"));
+    ASSERT_EQ(date_time->time().offset(), TimeZone::EAST_2);
+    ASSERT_EQ(DateTime::fromSinceEpoch(std::chrono::nanoseconds(-1), Precision::NANOSECONDS)->toString(), "1969-12-31T23:59:59.999.999.999+00");
+    ASSERT_EQ(DateTime::fromSinceEpoch(-std::chrono::hours(24 * 25568), Precision::SECONDS).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::fromDaysSinceEpoch(0)->daysSinceEpoch(), 0);
+    ASSERT_EQ(Date::fromDaysSinceEpoch(-25567).value(), Date(1, 1, 1900));
+    ASSERT_EQ(Date::fromDaysSinceEpoch(-25568).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::fromDaysSinceEpoch(67934).value(), Date(31, 12, 2155));
+    ASSERT_EQ(Date::fromDaysSinceEpoch(67935).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Time::fromSinceDayStart(std::chrono::hours(24), Precision::SECONDS).error(), ErrorCode::OUT_OF_RANGE);
+}
+
+TEST(HttpDate, Parse){
+    auto date_time = tryParseHttpDate("Sun, 06 Nov 1994 08:49:37 GMT");
+    ASSERT_TRUE(date_time);
+    ASSERT_EQ(*date_time, DateTime("1994-11-06T08:49:37"));
+    ASSERT_EQ(date_time->time().precision(), Precision::SECONDS);
+    ASSERT_EQ(date_time->time().offset(), TimeZone::UTC);
+    ASSERT_EQ(tryParseHttpDate("Sun, 06 Nov 1994 08:49:37 UTC").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseHttpDate("Sun, 06 Nox 1994 08:49:37 GMT").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseHttpDate("Sux, 06 Nov 1994 08:49:37 GMT").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseHttpDate("Sun, 6 Nov 1994 08:49:37 GMT").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseHttpDate("Sun, 31 Nov 1994 08:49:37 GMT").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseHttpDate("Sun, 06 Nov 1994 24:49:37 GMT").error(), ErrorCode::OUT_OF_RANGE);
+}
+
+TEST(HttpDate, Format){
+    ASSERT_EQ(toHttpDate(DateTime("1994-11-06T08:49:37")), "Sun, 06 Nov 1994 08:49:37 GMT");
+    ASSERT_EQ(toHttpDate(DateTime("2021-01-01T01:00:00.123+02")), "Thu, 31 Dec 2020 23:00:00 GMT");
+    for (const auto* http_date: {"Mon, 29 Feb 2016 12:00:59 GMT", "Sat, 01 Jan 2000 00:00:00 GMT", "Wed, 31 Dec 2036 23:59:59 GMT"}) {
+        ASSERT_EQ(toHttpDate(*tryParseHttpDate(http_date)), http_date);
+    }
+    auto now = httpDateNow();
+    ASSERT_EQ(now.size(), g_http_date_length);
+    ASSERT_TRUE(tryParseHttpDate(now));
+    auto seconds = std::chrono::duration_cast< std::chrono::seconds >(std::chrono::system_clock::now().time_since_epoch());
+    ASSERT_LE((seconds - tryParseHttpDate(now)->sinceEpoch()).count(), std::chrono::nanoseconds(std::chrono::seconds(1)).count());
+
+    std::atomic< size_t > invalid{0};
+    std::vector< std::thread > threads;
+    for (size_t thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([&] {
+            for (size_t call = 0; call < 20000; ++call) {
+                if (not tryParseHttpDate(httpDateNow())) {
+                    ++invalid;
+                }
+            }
+        });
+    }
+    for (auto& thread: threads) {
+        thread.join();
+    }
+    ASSERT_EQ(invalid.load(), 0);
+}
+
+TEST(LogTimestamp, Clf){
+    auto date_time = tryParseClf("[10/Oct/2000:13:55:36 -0700]");
+    ASSERT_TRUE(date_time);
+    ASSERT_EQ(*date_time, DateTime("2000-10-10T13:55:36-07"));
+    ASSERT_EQ(date_time->time().offset(), TimeZone::WEST_7);
+    ASSERT_EQ(tryParseClfSinceEpoch("10/Oct/2000:13:55:36 -0700").value(), date_time->sinceEpoch());
+
+    auto with_minutes = tryParseClf("10/Oct/2000:13:55:36 +0530");
+    ASSERT_EQ(with_minutes->time().offset(), TimeZone::UTC);
+    ASSERT_EQ(with_minutes->toString(), "2000-10-10T08:25:36+00");
+    ASSERT_EQ(tryParseClfSinceEpoch("10/Oct/2000:13:55:36 +0530").value(), with_minutes->sinceEpoch());
+
+    ASSERT_EQ(tryParseClf("[10/Oct/2000:13:55:36 -0700").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseClf("10/oct/2000:13:55:36 -0700").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseClf("10/Oct/2000 13:55:36 -0700").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseClf("10/Oct/2000:13:55:36 -0760").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseClf("31/Sep/2000:13:55:36 -0700").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseClfSinceEpoch("10/Oct/2000:24:55:36 -0700").error(), ErrorCode::OUT_OF_RANGE);
+}
+
+TEST(LogTimestamp, Rfc3164){
+    const Date reference("2021-01-05");
+    ASSERT_EQ(tryParseRfc3164("Jan  5 22:14:15", reference)->toString(), "2021-01-05T22:14:15+00");
+    ASSERT_EQ(tryParseRfc3164("Dec 31 23:59:59", reference)->toString(), "2020-12-31T23:59:59+00");
+    ASSERT_EQ(tryParseRfc3164("Feb  5 00:00:00", reference)->toString(), "2021-02-05T00:00:00+00");
+    ASSERT_EQ(tryParseRfc3164("Feb 29 00:00:00", Date("2021-03-01"))->toString(), "2020-02-29T00:00:00+00");
+    ASSERT_EQ(tryParseRfc3164("Jan  1 00:00:00", Date("2021-12-31"))->toString(), "2022-01-01T00:00:00+00");
+    ASSERT_EQ(tryParseRfc3164SinceEpoch("Oct 11 22:14:15", reference).value(), DateTime("2020-10-11T22:14:15").sinceEpoch());
+    ASSERT_EQ(tryParseRfc3164("Oct 11 22:14", reference).error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3164("Oct 1  22:14:15", reference).error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3164("Oct 32 22:14:15", reference).error(), ErrorCode::OUT_OF_RANGE);
+}
+
+TEST(LogTimestamp, Rfc5424){
+    auto date_time = tryParseRfc5424("2003-10-11T22:14:15.003Z");
+    ASSERT_EQ(date_time->time().precision(), Precision::MILLISECONDS);
+    ASSERT_EQ(*date_time, DateTime("2003-10-11T22:14:15.003"));
+    ASSERT_EQ(tryParseRfc5424SinceEpoch("2003-08-24T05:14:15.000003-07:00").value(), DateTime("2003-08-24T12:14:15.000.003").sinceEpoch());
+    ASSERT_EQ(tryParseRfc5424("-").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc5424("2003-10-11t22:14:15Z").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc5424("2003-10-11T22:14:15.0000003Z").error(), ErrorCode::INVALID_FORMAT);
+}
+
+TEST(EpochText, Parse){
+    auto date_time = tryParseEpoch("1697040000.123456789");
+    ASSERT_EQ(date_time->time().precision(), Precision::NANOSECONDS);
+    ASSERT_EQ(*date_time, DateTime("2023-10-11T16:00:00.123.456.789"));
+    ASSERT_EQ(tryParseEpoch("1697040000")->time().precision(), Precision::SECONDS);
+    ASSERT_EQ(tryParseEpoch("1697040000.1")->time().precision(), Precision::MILLISECONDS);
+    ASSERT_EQ(tryParseEpoch("1697040000123", EpochUnit::MILLISECONDS)->time().precision(), Precision::MILLISECONDS);
+    ASSERT_EQ(tryParseEpoch("1697040000123.4", EpochUnit::MILLISECONDS)->time().precision(), Precision::MICROSECONDS);
+
+    const auto reference = std::chrono::nanoseconds(1697040000123456789);
+    ASSERT_EQ(tryParseEpochSinceEpoch("1697040000123.456789", EpochUnit::MILLISECONDS).value(), reference);
+    ASSERT_EQ(tryParseEpochSinceEpoch("1697040000123456.789", EpochUnit::MICROSECONDS).value(), reference);
+    ASSERT_EQ(tryParseEpochSinceEpoch("1697040000123456789", EpochUnit::NANOSECONDS).value(), reference);
+    ASSERT_EQ(tryParseEpochSinceEpoch("1697040000123456789.9", EpochUnit::NANOSECONDS).value(), reference);
+    ASSERT_EQ(tryParseEpochSinceEpoch("1697040000123.456789999", EpochUnit::MILLISECONDS).value(), reference);
+    ASSERT_EQ(tryParseEpochSinceEpoch("-1.5").value(), -std::chrono::milliseconds(1500));
+    ASSERT_EQ(tryParseEpochSinceEpoch("0").value(), std::chrono::nanoseconds(0));
+    ASSERT_EQ(tryParseEpochSinceEpoch("9223372036854775807", EpochUnit::NANOSECONDS).value(), std::chrono::nanoseconds::max());
+
+    ASSERT_EQ(tryParseEpoch("").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpoch("-").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpoch(".5").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpoch("1697040000.").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpoch("1697040000.1234567890").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpoch("16970400x0").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpoch("6000000000").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseEpoch("1697040000.12345678x").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseEpochSinceEpoch("9223372036854775808", EpochUnit::NANOSECONDS).error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseEpochSinceEpoch("9223372036.854775808").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseEpoch("-2208988801").error(), ErrorCode::OUT_OF_RANGE);
+}
+
+TEST(EpochText, Format){
+    const DateTime date_time("2023-10-11T16:00:00.123.456.789");
+    ASSERT_EQ(toEpochString(date_time), "1697040000.123456789");
+    ASSERT_EQ(toEpochString(date_time, EpochUnit::MILLISECONDS), "1697040000123.456789");
+    ASSERT_EQ(toEpochString(date_time, EpochUnit::NANOSECONDS), "1697040000123456789");
+    ASSERT_EQ(toEpochString(date_time, EpochUnit::SECONDS, 0), "1697040000");
+    ASSERT_EQ(toEpochString(date_time, EpochUnit::SECONDS, 2), "1697040000.12");
+    ASSERT_EQ(toEpochString(date_time, EpochUnit::MICROSECONDS, 9), "1697040000123456.789000000");
+    ASSERT_EQ(toEpochString(DateTime("2023-10-11T18:00:00.005+02")), "1697040000.005");
+    ASSERT_EQ(toEpochString(DateTime("1969-12-31T23:59:58.500")), "-1.500");
+    ASSERT_EQ(toEpochString(DateTime("1970-01-01T00:00:00")), "0");
+    ASSERT_THROW(static_cast< void >(toEpochString(date_time, EpochUnit::SECONDS, 10)), std::invalid_argument);
+    for (const auto* epoch_text: {"1697040000.123456789", "-1.000000001", "1.000000001", "12345678.9"}) {
+        ASSERT_EQ(toEpochString(*tryParseEpoch(epoch_text), EpochUnit::SECONDS, 9).substr(0, std::string_view(epoch_text).size()), epoch_text);
+    }
+}
+
+TEST(Rfc3339, Parse){
+    auto date_time = tryParseRfc3339("2021-08-25T23:23:23.123456Z");
+    ASSERT_EQ(date_time->time().precision(), Precision::MICROSECONDS);
+    ASSERT_EQ(*date_time, DateTime("2021-08-25T23:23:23.123.456"));
+    ASSERT_EQ(tryParseRfc3339("2021-08-25t23:23:23z")->time().precision(), Precision::SECONDS);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23.1+02:00")->time().milliseconds(), 100);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23.1+02:00")->time().offset(), TimeZone::EAST_2);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23.123456789-02:00")->time().precision(), Precision::NANOSECONDS);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23+05:30")->sinceEpoch(), DateTime("2021-08-25T17:53:23").sinceEpoch());
+
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23.Z").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23.1234567890Z").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23+02").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25 23:23:23Z").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23Zx").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T24:23:23Z").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseRfc3339("2021-02-29T23:23:23Z").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseRfc3339("2021-08-25T23:23:23+24:00").error(), ErrorCode::OUT_OF_RANGE);
+
+    auto time = tryParseRfc3339Time("12:34:56.123456Z");
+    ASSERT_EQ(time->precision(), Precision::MICROSECONDS);
+    ASSERT_EQ(*time, Time("12:34:56.123.456"));
+    ASSERT_EQ(tryParseRfc3339Time("12:34:56-03:00")->offset(), TimeZone::WEST_3);
+    ASSERT_EQ(tryParseRfc3339Time("12:34:56+05:30").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(tryParseRfc3339Time("12:34:56").error(), ErrorCode::INVALID_FORMAT);
+}
+
+TEST(Rfc3339, Format){
+    ASSERT_EQ(toRfc3339(DateTime("2021-08-25T23:23:23")), "2021-08-25T23:23:23Z");
+    ASSERT_EQ(toRfc3339(DateTime("2021-08-25T23:23:23.012+02")), "2021-08-25T23:23:23.012+02:00");
+    ASSERT_EQ(toRfc3339(DateTime("2021-08-25T23:23:23.000.001-11")), "2021-08-25T23:23:23.000001-11:00");
+    ASSERT_EQ(toRfc3339(Time("01:02:03.004.005.006")), "01:02:03.004005006Z");
+    for (const auto* rfc3339: {"2021-08-25T23:23:23.123456789-02:00", "1900-01-01T00:00:00.5Z", "2155-12-31T23:59:59.999999+12:00"}) {
+        auto date_time = tryParseRfc3339(rfc3339);
+        ASSERT_EQ(*tryParseRfc3339(toRfc3339(*date_time)), *date_time);
+    }
+}
+
+TEST(Date, IsoWeekAndOrdinal){
+    Date date("2024-01-31");
+    ASSERT_EQ(date.isoWeek(), 5);
+    ASSERT_EQ(date.isoWeekYear(), 2024);
+    ASSERT_EQ(date.isoWeekDate().day, 3);
+    ASSERT_EQ(date.dayOfTheYear(), 31);
+    ASSERT_EQ(date.toIsoWeekString(), "2024-W05-3");
+    ASSERT_EQ(Date("2024-05-02").toOrdinalString(), "2024-123");
+    ASSERT_EQ(Date("2008-12-29").toIsoWeekString(), "2009-W01-1");
+    ASSERT_EQ(Date("2010-01-03").toIsoWeekString(), "2009-W53-7");
+    ASSERT_EQ(Date("2004-12-31").toIsoWeekString(), "2004-W53-5");
+    ASSERT_EQ(Date("2023-12-31").toOrdinalString(), "2023-365");
+    ASSERT_EQ(Date("2024-12-31").toOrdinalString(), "2024-366");
+
+    ASSERT_EQ(*Date::tryParseIsoWeek("2024-W05-3"), date);
+    ASSERT_EQ(*Date::tryParseIsoWeek("2024W053"), date);
+    ASSERT_EQ(*Date::tryParseIsoWeek("2009-W01-1"), Date("2008-12-29"));
+    ASSERT_EQ(*Date::tryParseOrdinal("2024-123"), Date("2024-05-02"));
+    ASSERT_EQ(*Date::tryParseOrdinal("2024123"), Date("2024-05-02"));
+    ASSERT_EQ(Date::tryParseIsoWeek("2024-W5-3").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(Date::tryParseIsoWeek("2024-05-31").error(), ErrorCode::INVALID_FORMAT);
+    ASSERT_EQ(Date::tryParseIsoWeek("2023-W53-1").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseIsoWeek("2024-W05-8").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseIsoWeek("2024-W00-1").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseOrdinal("2023-366").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseOrdinal("2023-000").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseOrdinal("2023-36").error(), ErrorCode::INVALID_FORMAT);
+
+    ASSERT_EQ(*Date::tryParseIsoWeek("1900-W01-1"), Date(1, 1, 1900));
+    ASSERT_EQ(*Date::tryParseIsoWeek("2156-W01-3"), Date(31, 12, 2155));
+    ASSERT_EQ(Date::tryParseIsoWeek("2156-W01-4").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseIsoWeek("9999-W01-1").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(*Date::tryParseOrdinal("1900-001"), Date(1, 1, 1900));
+    ASSERT_EQ(*Date::tryParseOrdinal("2155-365"), Date(31, 12, 2155));
+    ASSERT_EQ(Date::tryParseOrdinal("1899-365").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseOrdinal("2156-001").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(Date::tryParseOrdinal("9999-001").error(), ErrorCode::OUT_OF_RANGE);
+
+    // Walk through all days and compare with week date advanced day by day.
+    IsoWeekDate expected{1900, 1, 1};
+    for (int64_t days = Date("1900-01-01").daysSinceEpoch(), last = Date("2155-12-28").daysSinceEpoch(); days <= last; ++days) {
+        auto current = *Date::fromDaysSinceEpoch(days);
+        if (expected.day == 8) {
+            expected.day = 1;
+            ++expected.week;
+            auto thursday = *Date::fromDaysSinceEpoch(days + 3);
+            if (thursday.month() == 1 && thursday.dayOfTheMonth() <= 7) {
+                expected.year = thursday.year();
+                expected.week = 1;
+            }
+        }
+        auto iso_week_date = current.isoWeekDate();
+        ASSERT_EQ(iso_week_date.year, expected.year);
+        ASSERT_EQ(iso_week_date.week, expected.week);
+        ASSERT_EQ(iso_week_date.day, expected.day);
+        ASSERT_EQ(*Date::fromIsoWeekDate(iso_week_date), current);
+        ASSERT_EQ(*Date::fromOrdinal(current.year(), current.dayOfTheYear()), current);
+        ++expected.day;
+    }
+}
+
+TEST(Batch, IsoWeekAndDayOfTheYear){
+    const std::vector< int32_t > days{static_cast< int32_t >(Date("2024-01-31").daysSinceEpoch()), static_cast< int32_t >(Date("2010-01-03").daysSinceEpoch())};
+    std::vector< uint16_t > week_years(2);
+    std::vector< uint8_t > weeks(2);
+    std::vector< uint16_t > days_of_the_year(2);
+    isoWeekBatch(days, week_years, weeks);
+    dayOfTheYearBatch(days, days_of_the_year);
+    ASSERT_EQ(week_years, (std::vector< uint16_t >{2024, 2009}));
+    ASSERT_EQ(weeks, (std::vector< uint8_t >{5, 53}));
+    ASSERT_EQ(days_of_the_year, (std::vector< uint16_t >{31, 3}));
+    isoWeekBatch(days, {}, weeks);
+    ASSERT_THROW(isoWeekBatch(days, std::span< uint16_t >(week_years.data(), 1), weeks), std::invalid_argument);
+    ASSERT_THROW(dayOfTheYearBatch(days, {}), std::invalid_argument);
+}
+
+namespace {
+    using namespace tristan::literals;
+
+    constexpr auto g_literal_date = "2024-02-29"_date;
+    constexpr auto g_literal_time = "09:30:00.001.002-03"_time;
+    constexpr auto g_literal_date_time = "20240101T09:30+02"_dt;
+
+    static_assert(g_literal_date.daysSinceEpoch() == 19782);
+    static_assert("2155-12-31"_date.daysSinceEpoch() == 67934);
+    static_assert(g_literal_time.precision() == Precision::MICROSECONDS);
+    static_assert(g_literal_time.sinceDayStart() == std::chrono::hours(9) + std::chrono::minutes(30) + std::chrono::microseconds(1002));
+    static_assert(g_literal_date_time.sinceEpoch() == std::chrono::hours(19723 * 24 + 7) + std::chrono::minutes(30));
+}  // namespace
+
+TEST(Literals, Conversion){
+    ASSERT_EQ(Date(g_literal_date), Date("2024-02-29"));
+    ASSERT_EQ(Date("19000101"_date), Date("1900-01-01"));
+    ASSERT_EQ(Date("21551231"_date), Date("2155-12-31"));
+    Time time = g_literal_time;
+    ASSERT_EQ(time, Time("09:30:00.001.002-03"));
+    ASSERT_EQ(time.precision(), Precision::MICROSECONDS);
+    ASSERT_EQ(time.offset(), TimeZone::WEST_3);
+    ASSERT_EQ(Time("23:59"_time).precision(), Precision::MINUTES);
+    ASSERT_EQ(Time("23:59:59.999.999.999"_time), Time("23:59:59.999.999.999"));
+    DateTime date_time = g_literal_date_time;
+    ASSERT_EQ(date_time, DateTime("2024-01-01T09:30+02"));
+    ASSERT_EQ(date_time.sinceEpoch(), g_literal_date_time.sinceEpoch());
+}
+
+TEST(Streams, Extraction){
+    std::istringstream input("  2024-01-31 09:30:00+02\n2024-01-31T09:30,20240229");
+    Date date;
+    Time time;
+    DateTime date_time;
+    input >> date >> time >> date_time;
+    ASSERT_TRUE(input.good());
+    ASSERT_EQ(date, Date("2024-01-31"));
+    ASSERT_EQ(time, Time("09:30:00+02"));
+    ASSERT_EQ(time.offset(), TimeZone::EAST_2);
+    ASSERT_EQ(date_time, DateTime("2024-01-31T09:30"));
+    ASSERT_EQ(input.get(), ',');
+    input >> date;
+    ASSERT_EQ(date, Date("2024-02-29"));
+    ASSERT_TRUE(input.eof());
+    ASSERT_FALSE(input.fail());
+
+    std::istringstream invalid("2024-02-30");
+    invalid >> date;
+    ASSERT_TRUE(invalid.fail());
+    ASSERT_EQ(date, Date("2024-02-29"));
+
+    std::istringstream no_skip(" 09:30");
+    no_skip >> std::noskipws >> time;
+    ASSERT_TRUE(no_skip.fail());
+
+    std::istringstream too_long("2024-01-31T09:30:00.000.000.000+02:00");
+    too_long >> date_time;
+    ASSERT_FALSE(too_long.fail());
+    ASSERT_EQ(date_time, DateTime("2024-01-31T09:30:00.000.000.000+02"));
+    ASSERT_EQ(too_long.get(), ':');
+
+    std::istringstream adjacent("2024-01-01-2024-02-01 09:30-10:45");
+    adjacent >> date;
+    ASSERT_EQ(date, Date("2024-01-01"));
+    ASSERT_EQ(adjacent.get(), '-');
+    adjacent >> date >> time;
+    ASSERT_TRUE(adjacent.good());
+    ASSERT_EQ(date, Date("2024-02-01"));
+    ASSERT_EQ(time, Time("09:30-10"));
+    ASSERT_EQ(adjacent.get(), ':');
+
+    std::istringstream truncated("09:30:1");
+    truncated >> time;
+    ASSERT_TRUE(truncated.fail());
+
+    std::istringstream empty("   ");
+    empty >> time;
+    ASSERT_TRUE(empty.fail());
+    ASSERT_TRUE(empty.eof());
+
+    // Extraction changes the value only, local formatters are kept.
+    date.setLocalFormatter([](const Date& p_date) { return "date " + std::to_string(p_date.year()); });
+    time.setLocalFormatter([](const Time& p_time) { return "time " + std::to_string(p_time.hours()); });
+    date_time.setLocalFormatter([](const DateTime& p_date_time) { return "date_time " + std::to_string(p_date_time.date().month()); });
+    date_time.setTimeLocalFormatter([](const Time& p_time) { return "inner " + std::to_string(p_time.minutes()); });
+    std::istringstream formatted("2030-05-06 07:08+03 2031-12-01T10:20:30");
+    formatted >> date >> time >> date_time;
+    ASSERT_FALSE(formatted.fail());
+    ASSERT_EQ(date.toString(), "date 2030");
+    ASSERT_EQ(time.toString(), "time 7");
+    ASSERT_EQ(time.offset(), TimeZone::EAST_3);
+    ASSERT_EQ(date_time.toString(), "date_time 12");
+    ASSERT_EQ(date_time.time().toString(), "inner 20");
+    ASSERT_EQ(date_time.time().precision(), Precision::SECONDS);
+}
+
+TEST(Formatting, ToChars){
+    std::array< char, g_date_time_max_length > buffer{};
+    auto written = [&buffer](std::to_chars_result result) {
+        EXPECT_EQ(result.ec, std::errc{});
+        return std::string(buffer.data(), result.ptr);
+    };
+    ASSERT_EQ(written(Date("1900-01-01").toChars(buffer.data(), buffer.data() + buffer.size())), "1900-01-01");
+    ASSERT_EQ(written(Time("09:05").toChars(buffer.data(), buffer.data() + buffer.size())), "09:05+00");
+    ASSERT_EQ(written(Time("23:59:59-07").toChars(buffer.data(), buffer.data() + buffer.size())), "23:59:59-07");
+    ASSERT_EQ(written(Time("00:00:00.001.020.300+12").toChars(buffer.data(), buffer.data() + buffer.size())), "00:00:00.001.020.300+12");
+    ASSERT_EQ(written(DateTime("2155-12-31T23:59:59.999.999-11").toChars(buffer.data(), buffer.data() + buffer.size())),
+              "2155-12-31T23:59:59.999.999-11");
+    for (const auto* date_time: {"2024-02-29T09:30", "2021-08-25T23:23:23.123+02", "1970-01-01T00:00:00.000.000.001+10"}) {
+        ASSERT_EQ(written(DateTime(date_time).toChars(buffer.data(), buffer.data() + buffer.size())), DateTime(date_time).toString());
+    }
+
+    buffer.fill('#');
+    const DateTime date_time("2024-01-31T09:30:00.123+02");
+    auto result = date_time.toChars(buffer.data(), buffer.data() + 25);
+    ASSERT_EQ(result.ec, std::errc::value_too_large);
+    ASSERT_EQ(result.ptr, buffer.data() + 25);
+    ASSERT_EQ(std::string(buffer.data(), 25), std::string(25, '#'));
+    ASSERT_EQ(Date().toChars(buffer.data(), buffer.data() + 9).ec, std::errc::value_too_large);
+    ASSERT_EQ(written(date_time.toChars(buffer.data(), buffer.data() + 26)), "2024-01-31T09:30:00.123+02");
+
+    std::string text = "at ";
+    Date date("2024-01-31");
+    date.setLocalFormatter([](const Date&) { return std::string("local"); });
+    date.appendTo(text);
+    text += ' ';
+    Time("09:30").appendTo(text);
+    text += ' ';
+    date_time.appendTo(text);
+    ASSERT_EQ(text, "at 2024-01-31 09:30+00 2024-01-31T09:30:00.123+02");
+}
+
+TEST(Formatting, FixedString){
+    const DateTime date_time("2024-01-01T12:34:56.123.456.789+02");
+    const auto text = date_time.toFixedString();
+    static_assert(decltype(text)::capacity() == 34);
+    ASSERT_EQ(text.size(), 34);
+    ASSERT_EQ(text, "2024-01-01T12:34:56.123.456.789+02");
+    std::string_view view = text;
+    ASSERT_EQ(view, date_time.toString());
+    ASSERT_EQ(Date("2024-01-01").toFixedString(), "2024-01-01");
+    ASSERT_EQ(Time("12:34-05").toFixedString().str(), "12:34-05");
+    std::ostringstream stream;
+    stream << Time("12:34:56").toFixedString();
+    ASSERT_EQ(stream.str(), "12:34:56+00");
+}
+
+TEST(FormatPattern, Format){
+    constexpr FormatPattern compact("%Y%m%d %H:%M:%S.%f");
+    static_assert(compact.maxLength() == 27);
+    const DateTime date_time("2024-02-29T09:05:07.012.345+02");
+    ASSERT_EQ(compact.format(date_time), "20240229 09:05:07.012345");
+    ASSERT_EQ(compact.format(DateTime("2024-02-29T09:05")), "20240229 09:05:00.000");
+    ASSERT_EQ(FormatPattern("%FT%T%z").format(date_time), "2024-02-29T09:05:07+02");
+    ASSERT_EQ(FormatPattern("%a, %d %b %Y %%%j %3f %9f").format(date_time), "Thu, 29 Feb 2024 %060 012 012345000");
+    ASSERT_EQ(FormatPattern("%T%z").format(Time("23:59:59.999-07")), "23:59:59-07");
+    ASSERT_EQ(FormatPattern("%d.%m.%Y").format(Date("1900-01-01")), "01.01.1900");
+    ASSERT_THROW(FormatPattern("%Y %q"), std::invalid_argument);
+    ASSERT_THROW(FormatPattern("%Y %"), std::invalid_argument);
+    ASSERT_THROW(FormatPattern("%4f"), std::invalid_argument);
+    ASSERT_THROW(FormatPattern("%6"), std::invalid_argument);
+    ASSERT_THROW(FormatPattern("%F %T").format(Date("1900-01-01")), std::invalid_argument);
+    ASSERT_THROW(FormatPattern("%F").toTimeFormatter(), std::invalid_argument);
+
+    std::array< char, 32 > buffer{};
+    ASSERT_EQ(compact.write(date_time, buffer.data(), buffer.data() + 25).ec, std::errc::value_too_large);
+    auto result = compact.write(date_time, buffer.data(), buffer.data() + buffer.size());
+    ASSERT_EQ(std::string_view(buffer.data(), static_cast< size_t >(result.ptr - buffer.data())), "20240229 09:05:07.012345");
+
+    DateTime local(date_time);
+    local.setLocalFormatter(compact.toFormatter());
+    ASSERT_EQ(local.toString(), "20240229 09:05:07.012345");
+    Date date("2024-01-31");
+    date.setLocalFormatter(FormatPattern("%d/%m/%Y").toDateFormatter());
+    ASSERT_EQ(date.toString(), "31/01/2024");
+    Time time("09:30");
+    time.setLocalFormatter(FormatPattern("%Hh%M").toTimeFormatter());
+    ASSERT_EQ(time.toString(), "09h30");
+}
+
+TEST(Formatting, FormatSpec){
+    const DateTime date_time("2024-01-31T09:30:00.123.456+02");
+    auto formatted = [](const auto& value, std::string_view spec) {
+        std::string result;
+        FormatSpec(spec).formatTo(value, std::back_inserter(result));
+        return result;
+    };
+    ASSERT_EQ(formatted(date_time, ""), "2024-01-31T09:30:00.123.456+02");
+    ASSERT_EQ(formatted(date_time, ".0"), "2024-01-31T09:30:00+02");
+    ASSERT_EQ(formatted(date_time, ".9"), "2024-01-31T09:30:00.123.456.000+02");
+    ASSERT_EQ(formatted(date_time, "%F %T.%3f"), "2024-01-31 09:30:00.123");
+    ASSERT_EQ(formatted(date_time.date(), ""), "2024-01-31");
+    ASSERT_EQ(formatted(date_time.date(), "%d.%m.%Y"), "31.01.2024");
+    ASSERT_EQ(formatted(date_time.time(), ".3"), "09:30:00.123+02");
+    ASSERT_EQ(formatted(date_time.time(), "%H:%M"), "09:30");
+    ASSERT_TRUE(FormatSpec(".3").usesTime());
+    ASSERT_FALSE(FormatSpec(".3").usesDate());
+    ASSERT_TRUE(FormatSpec("%F").usesDate());
+    ASSERT_THROW(FormatSpec(".4"), std::invalid_argument);
+    ASSERT_THROW(FormatSpec("x"), std::invalid_argument);
+
+    std::array< char, 64 > buffer{};
+    ASSERT_EQ(FormatSpec(".3").write(date_time.date(), buffer.data(), buffer.data() + buffer.size()).ec, std::errc::invalid_argument);
+    ASSERT_EQ(FormatSpec(".0").write(date_time, buffer.data(), buffer.data() + 11).ec, std::errc::value_too_large);
+#if defined(__cpp_lib_format)
+    ASSERT_EQ(std::format("[{}] [{:.0}] [{:%d.%m.%Y}]", date_time, date_time.time(), date_time.date()),
+              "[2024-01-31T09:30:00.123.456+02] [09:30:00+02] [31.01.2024]");
+    auto end = std::format_to_n(buffer.data(), buffer.size(), "{}", date_time).out;
+    ASSERT_EQ(std::string_view(buffer.data(), static_cast< size_t >(end - buffer.data())), "2024-01-31T09:30:00.123.456+02");
+    ASSERT_THROW((void)std::vformat("{:.3}", std::make_format_args(date_time.date())), std::format_error);
+#endif
+}
+
+TEST(Batch, FormatMatchesRowByRow){
+    std::vector< DateTime > values;
+    for (int64_t row = 0; row < 500; ++row) {
+        auto date = *Date::fromDaysSinceEpoch(-25567 + row * 187);
+        auto time = *Time::fromSinceDayStart(std::chrono::nanoseconds(row * 172799999999937 % 86400000000000),
+                                             Precision::NANOSECONDS,
+                                             static_cast< TimeZone >(row % 25 - 12));
+        values.emplace_back(std::move(date), std::move(time));
+    }
+    for (auto precision: {Precision::MINUTES, Precision::SECONDS, Precision::MILLISECONDS, Precision::MICROSECONDS, Precision::NANOSECONDS}) {
+        const auto row_length = batchRowLength(BatchFormat::DATE_TIME, precision);
+        std::string buffer(batchBufferSize(values.size(), BatchFormat::DATE_TIME, precision, "\n"), ' ');
+        std::vector< uint32_t > offsets(values.size() + 1);
+        ASSERT_EQ(formatBatch(values, precision, buffer, "\n", offsets), buffer.size());
+        ASSERT_EQ(offsets.back(), buffer.size());
+        for (size_t row = 0; row < values.size(); ++row) {
+            auto expected = Time::fromSinceDayStart(values[row].time().sinceDayStart(), precision, values[row].time().offset())->toFixedString();
+            ASSERT_EQ(buffer.substr(offsets[row], row_length), values[row].date().toString() + 'T' + std::string(expected.view()));
+            if (row + 1 < values.size()) {
+                ASSERT_EQ(buffer[offsets[row] + row_length], '\n');
+            }
+        }
+    }
+
+    std::string buffer(batchBufferSize(values.size(), BatchFormat::DATE_TIME, Precision::NANOSECONDS), ' ');
+    std::vector< uint32_t > offsets(values.size() + 1);
+    formatBatch(values, Precision::NANOSECONDS, buffer, {}, offsets);
+    std::vector< int64_t > epoch(values.size());
+    BatchColumns columns;
+    columns.epoch_nanoseconds = epoch;
+    ASSERT_EQ(parseBatch(buffer, offsets, columns), values.size());
+    for (size_t row = 0; row < values.size(); ++row) {
+        ASSERT_EQ(epoch[row], values[row].sinceEpoch().count());
+    }
+
+    std::string ticks(batchBufferSize(epoch.size(), BatchFormat::DATE_TIME, Precision::NANOSECONDS, ","), ' ');
+    formatBatch(std::span< const int64_t >(epoch), Precision::NANOSECONDS, ticks, ",", offsets, TimeZone::WEST_3);
+    for (size_t row = 0; row < values.size(); ++row) {
+        ASSERT_EQ(DateTime(ticks.substr(offsets[row], 34)).sinceEpoch(), values[row].sinceEpoch());
+    }
+    const std::vector< int64_t > out_of_range{-2208988800000000001};
+    ASSERT_THROW(formatBatch(std::span< const int64_t >(out_of_range), Precision::SECONDS, ticks), std::range_error);
+    const std::vector< int64_t > after_last_day{DateTime("2155-12-31T23:00").sinceEpoch().count()};
+    ASSERT_THROW(formatBatch(std::span< const int64_t >(after_last_day), Precision::SECONDS, ticks, {}, {}, TimeZone::EAST_3), std::range_error);
+    for (const int64_t limit: {std::numeric_limits< int64_t >::max(), std::numeric_limits< int64_t >::min()}) {
+        ASSERT_THROW(formatBatch(std::span< const int64_t >(&limit, 1), Precision::SECONDS, ticks, {}, {}, TimeZone::EAST_12), std::range_error);
+        ASSERT_THROW(formatBatch(std::span< const int64_t >(&limit, 1), Precision::SECONDS, ticks, {}, {}, TimeZone::WEST_12), std::range_error);
+    }
+    ASSERT_THROW(formatBatch(values, Precision::SECONDS, std::span< char >(buffer.data(), 10)), std::invalid_argument);
+    ASSERT_THROW(formatBatch(values, Precision::SECONDS, buffer, {}, std::span< uint32_t >(offsets.data(), 3)), std::invalid_argument);
+
+    const std::vector< Date > dates{Date("1900-01-01"), Date("2155-12-31")};
+    const std::vector< Time > times{Time("00:00-07"), Time("23:59:59.999+12")};
+    std::array< char, 32 > text{};
+    ASSERT_EQ(std::string_view(text.data(), formatBatch(dates, text, "|")), "1900-01-01|2155-12-31");
+    ASSERT_EQ(std::string_view(text.data(), formatBatch(times, Precision::SECONDS, text, " ")), "00:00:00-07 23:59:59+12");
+}
+
+TEST(Now, Cached){
+    const auto local_offset = DateTime::localDateTime().time().offset();
+    for (auto precision: {Precision::MINUTES, Precision::SECONDS, Precision::MILLISECONDS, Precision::MICROSECONDS, Precision::NANOSECONDS}) {
+        const auto expected_length = g_date_max_length + 1 + Time::fromSinceDayStart(std::chrono::nanoseconds(0), precision)->toFixedString().size();
+        auto local = DateTime::tryParse(localDateTimeNow(precision));
+        ASSERT_TRUE(local) << localDateTimeNow(precision);
+        ASSERT_EQ(localDateTimeNow(precision).size(), expected_length);
+        ASSERT_EQ(local->time().offset(), local_offset);
+        auto utc = DateTime::tryParse(utcDateTimeNow(precision));
+        ASSERT_TRUE(utc) << utcDateTimeNow(precision);
+        ASSERT_EQ(utc->time().offset(), TimeZone::UTC);
+        auto now = std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::system_clock::now().time_since_epoch());
+        ASSERT_LE((now - local->sinceEpoch()).count(), std::chrono::nanoseconds(std::chrono::minutes(1)).count());
+        ASSERT_LE((now - utc->sinceEpoch()).count(), std::chrono::nanoseconds(std::chrono::minutes(1)).count());
+        ASSERT_GE((now - utc->sinceEpoch()).count(), 0);
+    }
+    std::array< char, 16 > small{};
+    ASSERT_EQ(writeUtcDateTimeNow(small.data(), small.data() + small.size()).ec, std::errc::value_too_large);
+    ASSERT_EQ(small[0], '\0');
+    std::array< char, g_date_time_max_length > buffer{};
+    auto result = writeUtcDateTimeNow(buffer.data(), buffer.data() + buffer.size(), Precision::SECONDS);
+    ASSERT_EQ(std::string_view(buffer.data(), result.ptr).substr(0, 10), DateTime().date().toString());
+}
+
+TEST(Date, TextTable){
+    ASSERT_FALSE(Date::isTextTableEnabled());
+    std::vector< std::string > expected;
+    for (int64_t day = -25567; day < 67000; day += 7) {
+        expected.push_back(Date::fromDaysSinceEpoch(day)->toString());
+    }
+    Date::setTextTableEnabled(true);
+    ASSERT_TRUE(Date::isTextTableEnabled());
+    size_t index = 0;
+    for (int64_t day = -25567; day < 67000; day += 7) {
+        ASSERT_EQ(Date::fromDaysSinceEpoch(day)->toString(), expected[index++]);
+    }
+    ASSERT_EQ(Date("1900-01-01").toFixedString(), "1900-01-01");
+    ASSERT_EQ(Date("2155-12-31").toFixedString(), "2155-12-31");
+    ASSERT_EQ(Date::tryParse("2156-01-01").error(), ErrorCode::OUT_OF_RANGE);
+    ASSERT_EQ(DateTime("2024-02-29T12:00:00.123+03").toFixedString(), "2024-02-29T12:00:00.123+03");
+    Date::setTextTableEnabled(false);
+    ASSERT_EQ(Date("2024-02-29").toFixedString(), "2024-02-29");
+}
+
+TEST(Formatting, GlobalFormatterSwap){
+    const DateTime date_time("2024-02-29T12:34:56+03");
+    const std::string canonical = date_time.toString();
+    const FormatPattern pattern("%d.%m.%Y %H:%M");
+    std::atomic< bool > stop{false};
+    std::atomic< size_t > unexpected{0};
+    std::vector< std::thread > readers;
+    for (size_t thread = 0; thread < 4; ++thread) {
+        readers.emplace_back([&] {
+            while (not stop.load()) {
+                auto text = date_time.toString();
+                if (text != canonical && text != "29.02.2024 12:34") {
+                    ++unexpected;
+                }
+            }
+        });
+    }
+    for (size_t swap = 0; swap < 200; ++swap) {
+        DateTime::setGlobalFormatter(swap % 2 == 0 ? pattern.toFormatter() : tristan::date_time::Formatter{});
+    }
+    stop = true;
+    for (auto& reader: readers) {
+        reader.join();
+    }
+    ASSERT_EQ(unexpected.load(), 0);
+    ASSERT_EQ(date_time.toString(), canonical);
+
+    Date::setGlobalFormatter(FormatPattern("%d/%m/%Y").toDateFormatter());
+    ASSERT_EQ(date_time.date().toString(), "29/02/2024");
+    ASSERT_EQ(date_time.toString(), "29/02/2024T12:34:56+03");
+    Date::setGlobalFormatter({});
+    ASSERT_EQ(date_time.toString(), canonical);
+
+    // Replaced formatter is released by the thread which replaced it, other threads release it on their next formatting or exit.
+    auto captured = std::make_shared< int >(0);
+    Date::setGlobalFormatter([captured](const Date&) { return std::string("formatted"); });
+    ASSERT_EQ(date_time.date().toString(), "formatted");
+    ASSERT_EQ(captured.use_count(), 2);
+    Date::setGlobalFormatter({});
+    ASSERT_EQ(captured.use_count(), 1);
+
+    // Formatter which replaces itself keeps running, nested formatting uses the new one.
+    Date::setGlobalFormatter([captured](const Date& p_date) {
+        Date::setGlobalFormatter([](const Date&) { return std::string("replaced"); });
+        return p_date.toString() + " by " + std::to_string(*captured);
+    });
+    ASSERT_EQ(date_time.date().toString(), "replaced by 0");
+    ASSERT_EQ(date_time.date().toString(), "replaced");
+    ASSERT_EQ(captured.use_count(), 1);
+    Date::setGlobalFormatter({});
+    ASSERT_TRUE(date_time.date().usesDefaultFormatter());
+}
+
+TEST(Streams, Insertion){
+    DateTime date_time("2024-02-29T12:34:56.789+03");
+    std::ostringstream output;
+    output << date_time << ' ' << std::setw(12) << std::setfill('*') << date_time.date() << '|' << std::left << std::setw(10) << Time("09:30-07") << '|'
+           << date_time.time();
+    ASSERT_EQ(output.str(), "2024-02-29T12:34:56.789+03 **2024-02-29|09:30-07**|12:34:56.789+03");
+    ASSERT_TRUE(date_time.usesDefaultFormatter());
+
+    date_time.setTimeLocalFormatter(FormatPattern("%H.%M").toTimeFormatter());
+    ASSERT_FALSE(date_time.usesDefaultFormatter());
+    output.str("");
+    output << std::setw(20) << std::right << std::setfill(' ') << date_time;
+    ASSERT_EQ(output.str(), "    2024-02-29T12.34");
+    date_time.setTimeLocalFormatter({});
+    ASSERT_TRUE(date_time.usesDefaultFormatter());
+
+    Date::setGlobalFormatter(FormatPattern("%d.%m.%Y").toDateFormatter());
+    ASSERT_FALSE(date_time.date().usesDefaultFormatter());
+    output.str("");
+    output << date_time.date();
+    ASSERT_EQ(output.str(), "29.02.2024");
+    Date::setGlobalFormatter({});
+}
+
+TEST(TimestampRenderer, SpscRing){
+    SpscRing< uint32_t, 4 > ring;
+    for (uint32_t value = 0; value < 4; ++value) {
+        ASSERT_TRUE(ring.tryPush(value));
+    }
+    ASSERT_FALSE(ring.tryPush(4));
+    std::array< uint32_t, 3 > values{};
+    ASSERT_EQ(ring.popBatch(values), 3);
+    ASSERT_EQ(values, (std::array< uint32_t, 3 >{0, 1, 2}));
+    ASSERT_TRUE(ring.tryPush(4));
+    ASSERT_EQ(ring.size(), 2);
+    ASSERT_EQ(ring.popBatch(values), 2);
+    ASSERT_EQ(values[0], 3);
+    ASSERT_EQ(values[1], 4);
+    uint32_t value = 0;
+    ASSERT_FALSE(ring.tryPop(value));
+
+    SpscRing< uint64_t, 64 > shared;
+    constexpr uint64_t count = 10000;
+    std::vector< uint64_t > received;
+    received.reserve(count);
+    // Assertions are made on the main thread, as failed assertion in the consumer would leave the producer waiting for the free slot.
+    std::thread consumer([&] {
+        std::array< uint64_t, 16 > batch{};
+        while (received.size() < count) {
+            const auto popped = shared.popBatch(batch);
+            if (popped == 0) {
+                std::this_thread::yield();
+            }
+            received.insert(received.end(), batch.begin(), batch.begin() + static_cast< std::ptrdiff_t >(popped));
+        }
+    });
+    for (uint64_t next = 0; next < count;) {
+        if (shared.tryPush(next)) {
+            ++next;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+    ASSERT_EQ(shared.size(), 0);
+    ASSERT_EQ(received.size(), count);
+    for (uint64_t index = 0; index < count; ++index) {
+        ASSERT_EQ(received[index], index);
+    }
+}
+
+TEST(TimestampRenderer, Render){
+    std::vector< std::pair< uint64_t, std::string > > rendered;
+    std::vector< std::pair< size_t, size_t > > batch_sizes;
+    const auto first = DateTime("2024-02-29T23:59:59.123.456.789").sinceEpoch().count();
+    {
+        // The sink runs on the renderer thread, so it only records what is checked after stop().
+        TimestampRenderer renderer(
+            [&](const RenderedBatch& batch) {
+                batch_sizes.emplace_back(batch.size(), batch.offsets.size());
+                for (size_t row = 0; row < batch.size(); ++row) {
+                    rendered.emplace_back(batch.tags[row], batch[row]);
+                }
+            },
+            FormatSpec(".3"),
+            TimeZone::EAST_3);
+        for (uint64_t tag = 0; tag < 1000;) {
+            if (renderer.submit(CapturedTime{first + static_cast< int64_t >(tag) * 1000000}, tag)) {
+                ++tag;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        // Local date after 2155-12-31 and before 1900-01-01 is not representable.
+        ASSERT_TRUE(renderer.submit(CapturedTime{DateTime("2155-12-31T22:00").sinceEpoch().count()}, 1000));
+        ASSERT_TRUE(renderer.submit(CapturedTime{(DateTime("1900-01-01T00:00").sinceEpoch() - std::chrono::hours(4)).count()}, 1001));
+        ASSERT_TRUE(renderer.capture(1002));
+        renderer.stop();
+        ASSERT_EQ(rendered.size(), 1003);
+    }
+    for (const auto& [rows, offsets]: batch_sizes) {
+        ASSERT_LE(rows, TimestampRenderer::max_batch_size);
+        ASSERT_EQ(offsets, rows + 1);
+    }
+    for (uint64_t tag = 0; tag < 1000; ++tag) {
+        ASSERT_EQ(rendered[tag].first, tag);
+        auto expected = CapturedTime{first + static_cast< int64_t >(tag) * 1000000}.toDateTime(Precision::MILLISECONDS, TimeZone::EAST_3);
+        ASSERT_EQ(rendered[tag].second, expected->toString());
+    }
+    ASSERT_EQ(rendered[0].second, "2024-03-01T02:59:59.123+03");
+    ASSERT_EQ(rendered[1000], std::make_pair(uint64_t{1000}, std::string()));
+    ASSERT_EQ(rendered[1001], std::make_pair(uint64_t{1001}, std::string()));
+    ASSERT_TRUE(DateTime::tryParse(rendered.back().second));
+    ASSERT_THROW(TimestampRenderer(TimestampRenderer::Sink{}), std::invalid_argument);
+}
+
+TEST(FormatPattern, Localized){
+    const Date date("2026-10-17");
+    ASSERT_EQ(FormatPattern("%d %B %Y", Locale::FRENCH).format(date), "17 octobre 2026");
+    ASSERT_EQ(FormatPattern("%A", Locale::GERMAN).format(date), "Samstag");
+    ASSERT_EQ(FormatPattern("%a %d %b", Locale::SPANISH).format(date), "sáb 17 oct");
+    ASSERT_EQ(FormatPattern("%A, %d de %B", Locale::PORTUGUESE).format(Date("2024-02-26")), "segunda-feira, 26 de fevereiro");
+    ASSERT_EQ(FormatPattern("%a %d %b %Y", Locale::FRENCH).format(Date("2024-02-29")), "jeu. 29 févr. 2024");
+    ASSERT_EQ(FormatPattern("%A %B", Locale::ITALIAN).format(Date("2024-12-25")), "mercoledì dicembre");
+    ASSERT_EQ(FormatPattern("%A %d %B", Locale::DUTCH).format(Date("2024-03-31")), "zondag 31 maart");
+    ASSERT_EQ(FormatPattern("%A, %B %d, %Y").format(date), "Saturday, October 17, 2026");
+    ASSERT_EQ(FormatSpec("%d %B", Locale::GERMAN).write(date, nullptr, nullptr).ec, std::errc::value_too_large);
+
+    static_assert(FormatPattern("%A", Locale::PORTUGUESE).maxLength() == std::string_view("segunda-feira").size());
+    static_assert(FormatPattern("%a", Locale::GERMAN).maxLength() == 2);
+    static_assert(FormatPattern::max_length >= FormatPattern::max_steps * g_calendar_name_max_length);
+    for (auto locale: {Locale::ENGLISH, Locale::FRENCH, Locale::GERMAN, Locale::SPANISH, Locale::ITALIAN, Locale::PORTUGUESE, Locale::DUTCH}) {
+        const FormatPattern pattern("%a %A %b %B", locale);
+        for (int64_t day = 19000; day < 19365; ++day) {
+            std::array< char, FormatPattern::max_length > buffer{};
+            const auto checked = Date::fromDaysSinceEpoch(day).value();
+            auto result = pattern.write(checked, buffer.data(), buffer.data() + pattern.maxLength());
+            ASSERT_EQ(result.ec, std::errc{});
+            const auto& names = calendarNames(locale);
+            const auto expected = std::string(names.weekday_abbreviations[checked.dayOfTheWeek()]) + ' ' + std::string(names.weekdays[checked.dayOfTheWeek()])
+                                + ' ' + std::string(names.month_abbreviations[checked.month() - 1]) + ' ' + std::string(names.months[checked.month() - 1]);
+            ASSERT_EQ(std::string_view(buffer.data(), result.ptr), expected);
+        }
+    }
+}
@@ -0,0 +1,178 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include "date_time.hpp"
+
+#include <span>
+
+/**
+ * \brief Column oriented (structure of arrays) processing of DateTime values.
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Caller provided output columns for parseBatch.
+     * Every non empty column has to hold at least as many elements as there are input rows. Empty columns are not written.
+     * Columns of rejected rows are set to zero.
+     */
+    struct BatchColumns {
+        /// Nanoseconds passed since 1970-01-01T00:00:00 UTC, that is offset is subtracted. See DateTime::sinceEpoch().
+        std::span< int64_t > epoch_nanoseconds;
+        /// Date as number of days passed since 1970-01-01. See Date::daysSinceEpoch().
+        std::span< int32_t > days_since_epoch;
+        /// Time as number of nanoseconds passed since day start. See Time::sinceDayStart().
+        std::span< int64_t > nanoseconds_since_day_start;
+        /// Offset in hours.
+        std::span< int8_t > offsets;
+        /// Validity bitmap: bit (i % 8) of byte (i / 8) is set if row i was parsed. Has to hold at least (rows + 7) / 8 bytes.
+        std::span< uint8_t > validity;
+    };
+
+    /**
+     * \brief Parses column of date and time string representations without creating DateTime objects.
+     * Accepts the same formats as DateTime(std::string_view) and uses the same rules, so row i is valid if and only if
+     * DateTime::tryParse(p_rows[i], p_backend) succeeds and produces the same values.
+     * \param p_rows std::span<const std::string_view>.
+     * \param p_columns const BatchColumns&. Output columns.
+     * \param p_backend ParserBackend.
+     * \return size_t. Number of valid rows.
+     * \throws std::invalid_argument - if non empty output column is smaller than number of rows.
+     */
+    auto parseBatch(std::span< const std::string_view > p_rows, const BatchColumns& p_columns, ParserBackend p_backend = ParserBackend::AUTO) -> size_t;
+
+    /**
+     * \overload
+     * \brief Parses column which is stored as contiguous character buffer and offsets array (Arrow like string column layout).
+     * Row i is represented by characters [p_offsets[i], p_offsets[i + 1]) of the buffer.
+     * \param p_buffer std::string_view. Characters of all rows.
+     * \param p_offsets std::span<const uint32_t>. Number of rows plus one ascending offsets.
+     * \param p_columns const BatchColumns&. Output columns.
+     * \param p_backend ParserBackend.
+     * \return size_t. Number of valid rows.
+     * \throws std::invalid_argument - if non empty output column is smaller than number of rows or if offsets are out of buffer.
+     */
+    auto parseBatch(std::string_view p_buffer,
+                    std::span< const uint32_t > p_offsets,
+                    const BatchColumns& p_columns,
+                    ParserBackend p_backend = ParserBackend::AUTO) -> size_t;
+
+    /**
+     * \brief Computes ISO 8601 week-numbering year and week number of every day of the column, e.g. to group rows by week.
+     * \param p_days_since_epoch std::span<const int32_t>. Days passed since 1970-01-01, as produced by parseBatch.
+     * \param p_week_years std::span<uint16_t>. Output column, not written if empty.
+     * \param p_weeks std::span<uint8_t>. Output column, not written if empty.
+     * \throws std::invalid_argument - if non empty output column is smaller than input column.
+     */
+    void isoWeekBatch(std::span< const int32_t > p_days_since_epoch, std::span< uint16_t > p_week_years, std::span< uint8_t > p_weeks);
+
+    /**
+     * \brief Computes day of the year of every day of the column.
+     * \param p_days_since_epoch std::span<const int32_t>. Days passed since 1970-01-01, as produced by parseBatch.
+     * \param p_days_of_the_year std::span<uint16_t>. Output column.
+     * \throws std::invalid_argument - if output column is smaller than input column.
+     */
+    void dayOfTheYearBatch(std::span< const int32_t > p_days_since_epoch, std::span< uint16_t > p_days_of_the_year);
+
+    /**
+     * \brief Row layouts written by formatBatch.
+     */
+    enum class BatchFormat : uint8_t {
+        /// [YYYY-MM-DD].
+        DATE,
+        /// [HH:MM[:SS[.mmm[.mmm[.nnn]]]]+(-)HH].
+        TIME,
+        /// [YYYY-MM-DD]T[HH:MM[:SS[.mmm[.mmm[.nnn]]]]+(-)HH].
+        DATE_TIME
+    };
+
+    /**
+     * \brief Returns length of every row written by formatBatch. Rows have the same length as all values are written with the same precision.
+     * \param p_format BatchFormat.
+     * \param p_precision time::Precision. Ignored for BatchFormat::DATE.
+     * \return size_t.
+     */
+    [[nodiscard]] constexpr auto batchRowLength(BatchFormat p_format, time::Precision p_precision) -> size_t {
+        const auto l_groups = static_cast< size_t >(p_precision);
+        const size_t l_time = 8 + (l_groups > 0 ? 3 : 0) + (l_groups > 1 ? (l_groups - 1) * 4 : 0);
+        switch (p_format) {
+            case BatchFormat::DATE: {
+                return date::g_date_max_length;
+            }
+            case BatchFormat::TIME: {
+                return l_time;
+            }
+            case BatchFormat::DATE_TIME:
+            default: {
+                return date::g_date_max_length + 1 + l_time;
+            }
+        }
+    }
+
+    /**
+     * \brief Returns size of the buffer which is needed to format p_rows values with formatBatch.
+     * \param p_rows size_t.
+     * \param p_format BatchFormat.
+     * \param p_precision time::Precision.
+     * \param p_separator std::string_view.
+     * \return size_t.
+     */
+    [[nodiscard]] constexpr auto batchBufferSize(size_t p_rows, BatchFormat p_format, time::Precision p_precision, std::string_view p_separator = {})
+        -> size_t {
+        return p_rows == 0 ? 0 : p_rows * batchRowLength(p_format, p_precision) + (p_rows - 1) * p_separator.size();
+    }
+
+    /**
+     * \brief Writes canonical representation of every value into one contiguous buffer. See DateTime::toChars.
+     * All rows are written with p_precision, finer part is truncated and missing digits are zeros, so every row has batchRowLength() characters.
+     * Digits of several fields are converted at once in a 64 bit register.
+     * \param p_values std::span<const DateTime>.
+     * \param p_precision time::Precision.
+     * \param p_buffer std::span<char>. Has to hold at least batchBufferSize() characters.
+     * \param p_separator std::string_view. Written between rows.
+     * \param p_offsets std::span<uint32_t>. Not written if empty. Otherwise has to hold number of rows plus one elements:
+     * row i starts at p_offsets[i] and p_offsets[rows] is number of written characters. Without separator this is the layout accepted by parseBatch.
+     * \return size_t. Number of written characters.
+     * \throws std::invalid_argument - if buffer or non empty offsets column is too small.
+     */
+    auto formatBatch(std::span< const DateTime > p_values,
+                     time::Precision p_precision,
+                     std::span< char > p_buffer,
+                     std::string_view p_separator = {},
+                     std::span< uint32_t > p_offsets = {}) -> size_t;
+
+    /**
+     * \overload
+     * \brief Writes BatchFormat::DATE rows.
+     */
+    auto formatBatch(std::span< const date::Date > p_values,
+                     std::span< char > p_buffer,
+                     std::string_view p_separator = {},
+                     std::span< uint32_t > p_offsets = {}) -> size_t;
+
+    /**
+     * \overload
+     * \brief Writes BatchFormat::TIME rows.
+     */
+    auto formatBatch(std::span< const time::Time > p_values,
+                     time::Precision p_precision,
+                     std::span< char > p_buffer,
+                     std::string_view p_separator = {},
+                     std::span< uint32_t > p_offsets = {}) -> size_t;
+
+    /**
+     * \overload
+     * \brief Writes BatchFormat::DATE_TIME rows of packed ticks, e.g. epoch_nanoseconds column produced by parseBatch.
+     * \param p_epoch_nanoseconds std::span<const int64_t>. Nanoseconds passed since 1970-01-01T00:00:00 UTC.
+     * \param p_offset TimeZone. Offset of the written representation.
+     * \throws std::range_error - if local date is before 1900-01-01 or after 2155-12-31. Rows before such value are written.
+     */
+    auto formatBatch(std::span< const int64_t > p_epoch_nanoseconds,
+                     time::Precision p_precision,
+                     std::span< char > p_buffer,
+                     std::string_view p_separator = {},
+                     std::span< uint32_t > p_offsets = {},
+                     TimeZone p_offset = TimeZone::UTC) -> size_t;
+
+}  // namespace tristan::date_time
+
+#endif  // BATCH_HPP
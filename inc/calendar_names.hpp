@@ -0,0 +1,144 @@
+#ifndef CALENDAR_NAMES_HPP
+#define CALENDAR_NAMES_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * \brief English three letter month and day names used by HTTP, Common Log Format and syslog timestamps
+ * and localized month and day names used by FormatPattern.
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Languages of built in month and day names.
+     */
+    enum class Locale : uint8_t {
+        ENGLISH,
+        FRENCH,
+        GERMAN,
+        SPANISH,
+        ITALIAN,
+        PORTUGUESE,
+        DUTCH
+    };
+
+    /**
+     * \brief Month and day names of one language, UTF-8 encoded. Names are written as they appear inside a sentence,
+     * that is capitalized only if the language capitalizes them, e.g. [octobre] and [Oktober].
+     */
+    struct CalendarNames {
+        /// Month names, January first.
+        std::array< std::string_view, 12 > months;
+        /// Abbreviated month names, January first.
+        std::array< std::string_view, 12 > month_abbreviations;
+        /// Day names, Sunday first, so that Date::dayOfTheWeek() is an index.
+        std::array< std::string_view, 7 > weekdays;
+        /// Abbreviated day names, Sunday first.
+        std::array< std::string_view, 7 > weekday_abbreviations;
+
+        /**
+         * \brief Returns length in bytes of the longest name.
+         * \return size_t.
+         */
+        [[nodiscard]] constexpr auto maxLength() const -> size_t {
+            size_t l_length = 0;
+            for (const auto& l_names: {months, month_abbreviations}) {
+                for (const auto l_name: l_names) {
+                    l_length = std::max(l_length, l_name.size());
+                }
+            }
+            for (const auto& l_names: {weekdays, weekday_abbreviations}) {
+                for (const auto l_name: l_names) {
+                    l_length = std::max(l_length, l_name.size());
+                }
+            }
+            return l_length;
+        }
+    };
+
+    /**
+     * \brief Built in names, indexed by Locale. Tables are constant data, so selecting a language costs nothing at run time
+     * and does not touch std::locale.
+     */
+    inline constexpr std::array< CalendarNames, 7 > g_calendar_names{
+        CalendarNames{{"January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November", "December"},
+                      {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"},
+                      {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"},
+                      {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"}},
+        CalendarNames{{"janvier", "février", "mars", "avril", "mai", "juin", "juillet", "août", "septembre", "octobre", "novembre", "décembre"},
+                      {"janv.", "févr.", "mars", "avr.", "mai", "juin", "juil.", "août", "sept.", "oct.", "nov.", "déc."},
+                      {"dimanche", "lundi", "mardi", "mercredi", "jeudi", "vendredi", "samedi"},
+                      {"dim.", "lun.", "mar.", "mer.", "jeu.", "ven.", "sam."}},
+        CalendarNames{{"Januar", "Februar", "März", "April", "Mai", "Juni", "Juli", "August", "September", "Oktober", "November", "Dezember"},
+                      {"Jan", "Feb", "Mär", "Apr", "Mai", "Jun", "Jul", "Aug", "Sep", "Okt", "Nov", "Dez"},
+                      {"Sonntag", "Montag", "Dienstag", "Mittwoch", "Donnerstag", "Freitag", "Samstag"},
+                      {"So", "Mo", "Di", "Mi", "Do", "Fr", "Sa"}},
+        CalendarNames{{"enero", "febrero", "marzo", "abril", "mayo", "junio", "julio", "agosto", "septiembre", "octubre", "noviembre", "diciembre"},
+                      {"ene", "feb", "mar", "abr", "may", "jun", "jul", "ago", "sep", "oct", "nov", "dic"},
+                      {"domingo", "lunes", "martes", "miércoles", "jueves", "viernes", "sábado"},
+                      {"dom", "lun", "mar", "mié", "jue", "vie", "sáb"}},
+        CalendarNames{{"gennaio", "febbraio", "marzo", "aprile", "maggio", "giugno", "luglio", "agosto", "settembre", "ottobre", "novembre", "dicembre"},
+                      {"gen", "feb", "mar", "apr", "mag", "giu", "lug", "ago", "set", "ott", "nov", "dic"},
+                      {"domenica", "lunedì", "martedì", "mercoledì", "giovedì", "venerdì", "sabato"},
+                      {"dom", "lun", "mar", "mer", "gio", "ven", "sab"}},
+        CalendarNames{{"janeiro", "fevereiro", "março", "abril", "maio", "junho", "julho", "agosto", "setembro", "outubro", "novembro", "dezembro"},
+                      {"jan", "fev", "mar", "abr", "mai", "jun", "jul", "ago", "set", "out", "nov", "dez"},
+                      {"domingo", "segunda-feira", "terça-feira", "quarta-feira", "quinta-feira", "sexta-feira", "sábado"},
+                      {"dom", "seg", "ter", "qua", "qui", "sex", "sáb"}},
+        CalendarNames{{"januari", "februari", "maart", "april", "mei", "juni", "juli", "augustus", "september", "oktober", "november", "december"},
+                      {"jan", "feb", "mrt", "apr", "mei", "jun", "jul", "aug", "sep", "okt", "nov", "dec"},
+                      {"zondag", "maandag", "dinsdag", "woensdag", "donderdag", "vrijdag", "zaterdag"},
+                      {"zo", "ma", "di", "wo", "do", "vr", "za"}}};
+
+    /**
+     * \brief Returns names of the language.
+     * \param p_locale Locale.
+     * \return const CalendarNames&.
+     */
+    [[nodiscard]] constexpr auto calendarNames(Locale p_locale) -> const CalendarNames& { return g_calendar_names[static_cast< size_t >(p_locale)]; }
+
+    /**
+     * \brief Length in bytes of the longest built in name.
+     */
+    inline constexpr size_t g_calendar_name_max_length = [] {
+        size_t l_length = 0;
+        for (const auto& l_names: g_calendar_names) {
+            l_length = std::max(l_length, l_names.maxLength());
+        }
+        return l_length;
+    }();
+
+    /**
+     * \brief Returns three letter month name, e.g. [Jan].
+     * \param p_month uint8_t in range 1 - 12.
+     * \return std::string_view.
+     */
+    [[nodiscard]] auto monthAbbreviation(uint8_t p_month) -> std::string_view;
+
+    /**
+     * \brief Returns three letter day name, e.g. [Sun].
+     * \param p_day_of_the_week uint8_t in range 0 (Sunday) - 6, as returned by Date::dayOfTheWeek().
+     * \return std::string_view.
+     */
+    [[nodiscard]] auto weekdayAbbreviation(uint8_t p_day_of_the_week) -> std::string_view;
+
+    /**
+     * \brief Looks up three letter month name. Lookup is case sensitive and is done in perfect hash table, that is with one multiplication and one comparison.
+     * \param p_name const char* which points to at least 3 characters.
+     * \return uint8_t month in range 1 - 12 or 0 if name is unknown.
+     */
+    [[nodiscard]] auto monthFromAbbreviation(const char* p_name) noexcept -> uint8_t;
+
+    /**
+     * \brief Looks up three letter day name. See monthFromAbbreviation.
+     * \param p_name const char* which points to at least 3 characters.
+     * \return int8_t day of the week in range 0 (Sunday) - 6 or -1 if name is unknown.
+     */
+    [[nodiscard]] auto weekdayFromAbbreviation(const char* p_name) noexcept -> int8_t;
+
+}  // namespace tristan::date_time
+
+#endif  // CALENDAR_NAMES_HPP
@@ -2,12 +2,22 @@
 #define DATE_HPP
 
 #include "time_zones.hpp"
+#include "result.hpp"
+#include "fixed_string.hpp"
+#include "global_formatter.hpp"
 
+#include <charconv>
 #include <chrono>
 #include <string>
+#include <string_view>
+#include <istream>
 #include <ostream>
 #include <functional>
 
+namespace tristan::date_time {
+    class DateTime;
+}  // namespace tristan::date_time
+
 /**
  * \brief Namespace which includes date handlers
  */
@@ -15,6 +25,21 @@ namespace tristan::date {
 
     class Date;
 
+    /**
+     * \brief Maximal length of canonical [YYYY-MM-DD] representation written by Date::toChars.
+     */
+    inline constexpr size_t g_date_max_length = 10;
+
+    /**
+     * \brief Earliest year which Date holds.
+     */
+    inline constexpr uint16_t g_min_year = 1900;
+
+    /**
+     * \brief Latest year which Date holds. Year is stored as offset from g_min_year in uint8_t.
+     */
+    inline constexpr uint16_t g_max_year = 2155;
+
     /**
      * \brief Type definition for function signature which is used to format output
      */
@@ -25,11 +50,92 @@ namespace tristan::date {
      */
     using Days = std::chrono::duration< int64_t, std::ratio_divide< std::ratio< 86400 >, std::chrono::seconds::period > >;
 
+    /**
+     * \brief Returns number of days passed since 1970-01-01 for the valid date of proleptic Gregorian calendar. Year has to be not less than 1900.
+     * \note Years are counted from March so that leap day is the last day of the year and 400 years cycle (era) has fixed length of 146097 days.
+     * \param p_day uint8_t.
+     * \param p_month uint8_t.
+     * \param p_year uint16_t.
+     * \return int64_t.
+     */
+    [[nodiscard]] constexpr auto daysFromCivil(uint8_t p_day, uint8_t p_month, uint16_t p_year) -> int64_t {
+        const int64_t l_year = p_month <= 2 ? p_year - 1 : p_year;
+        const int64_t l_era = l_year / 400;
+        const int64_t l_year_of_era = l_year - l_era * 400;
+        const int64_t l_day_of_year = (153 * (p_month > 2 ? p_month - 3 : p_month + 9) + 2) / 5 + p_day - 1;
+        const int64_t l_day_of_era = l_year_of_era * 365 + l_year_of_era / 4 - l_year_of_era / 100 + l_day_of_year;
+        return l_era * 146097 + l_day_of_era - 719468;
+    }
+
+    /**
+     * \brief Day, month and year of proleptic Gregorian calendar.
+     */
+    struct CivilDate {
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+    };
+
+    /**
+     * \brief Reverse of daysFromCivil. Decodes day, month and year at once, which is cheaper than calling Date::year(), Date::month()
+     * and Date::dayOfTheMonth() one by one.
+     * \note Uses Neri-Schneider Euclidean affine functions: days are shifted by whole 400 years cycles so that all arithmetic is unsigned 32 bit
+     * and every division is by a constant. Valid for dates between years 1900 and 9999, which is wider than the range of Date.
+     * \param p_days_since_epoch int64_t.
+     * \return CivilDate.
+     */
+    [[nodiscard]] constexpr auto civilFromDays(int64_t p_days_since_epoch) -> CivilDate {
+        constexpr uint32_t l_cycles_shift = 82;
+        constexpr uint32_t l_days_shift = 719468 + 146097 * l_cycles_shift;
+        constexpr uint32_t l_years_shift = 400 * l_cycles_shift;
+        const uint32_t l_century_numerator = 4 * (static_cast< uint32_t >(p_days_since_epoch) + l_days_shift) + 3;
+        const uint32_t l_century = l_century_numerator / 146097;
+        const uint32_t l_year_numerator = 4 * (l_century_numerator % 146097 / 4) + 3;
+        const uint64_t l_year_product = uint64_t{2939745} * l_year_numerator;
+        const auto l_year_of_century = static_cast< uint32_t >(l_year_product >> 32);
+        const uint32_t l_day_of_year = static_cast< uint32_t >(l_year_product) / 2939745 / 4;
+        const uint32_t l_month_numerator = 2141 * l_day_of_year + 197913;
+        // Year starts in March, so January and February belong to the next civil year.
+        const bool l_next_year = l_day_of_year >= 306;
+        const uint32_t l_month = l_month_numerator >> 16;
+        return CivilDate{static_cast< uint16_t >(100 * l_century + l_year_of_century - l_years_shift + (l_next_year ? 1 : 0)),
+                         static_cast< uint8_t >(l_next_year ? l_month - 12 : l_month),
+                         static_cast< uint8_t >((l_month_numerator & 0xFFFF) / 2141 + 1)};
+    }
+
+    /**
+     * \brief ISO 8601 week date, e.g. [2024-W05-3].
+     */
+    struct IsoWeekDate {
+        /// ISO week-numbering year. Differs from the calendar year for some days at the end of December and at the beginning of January.
+        uint16_t year;
+        /// Week of the year in range 1 - 53. Week 1 is the week with the first Thursday of the year.
+        uint8_t week;
+        /// Day of the week in range 1 (Monday) - 7 (Sunday).
+        uint8_t day;
+    };
+
+    /**
+     * \brief Returns ISO 8601 week date of the day. Computed arithmetically, without iterating over days or weeks.
+     * \param p_days_since_epoch int64_t number of days passed since 1970-01-01.
+     * \return IsoWeekDate.
+     */
+    [[nodiscard]] auto isoWeekDateFromDaysSinceEpoch(int64_t p_days_since_epoch) noexcept -> IsoWeekDate;
+
+    /**
+     * \brief Returns day of the year of the day. Computed arithmetically.
+     * \param p_days_since_epoch int64_t number of days passed since 1970-01-01.
+     * \return uint16_t in range 1 - 366.
+     */
+    [[nodiscard]] auto dayOfTheYearFromDaysSinceEpoch(int64_t p_days_since_epoch) noexcept -> uint16_t;
+
     /**
      * \brief Class to handle date
      * \headerfile date.hpp
      */
     class Date {
+        friend auto operator>>(std::istream& in, Date& date) -> std::istream&;
+        friend class tristan::date_time::DateTime;
 
     public:
         /**
@@ -57,12 +163,14 @@ namespace tristan::date {
         /**
          * \overload
          * \brief Overloaded constructor
-         * Creates Date object from std::string representing the date in [YYYYMMDD] or [YYYY-MM-DD] formats.
-         * \param p_iso_date const std::string&.
+         * Creates Date object from string representing the date in [YYYYMMDD] or [YYYY-MM-DD] formats.
+         * \note No heap allocation is performed. Any contiguous character range may be passed: std::string, string literal or buffer pointer with length.
+         * \note This is a throwing wrapper around tryParse(std::string_view).
+         * \param p_iso_date std::string_view.
          * \throws std::invalid_argument - if time representation has invalid format.
          * \throws std::range_error - if date representation has invalid values.
          */
-        explicit Date(const std::string& p_iso_date);
+        explicit Date(std::string_view p_iso_date);
         /**
          * \brief Copy constructor
          */
@@ -153,12 +261,37 @@ namespace tristan::date {
          * \return uint8_t.
          */
         [[nodiscard]] auto year() const -> uint16_t;
+        /**
+         * \brief Returns day of the year, that is 1 for January 1st.
+         * \return uint16_t in range 1 - 366.
+         */
+        [[nodiscard]] auto dayOfTheYear() const -> uint16_t;
+        /**
+         * \brief Returns ISO 8601 week date. See isoWeekDateFromDaysSinceEpoch.
+         * \return IsoWeekDate.
+         */
+        [[nodiscard]] auto isoWeekDate() const -> IsoWeekDate;
+        /**
+         * \brief Returns ISO 8601 week number.
+         * \return uint8_t in range 1 - 53.
+         */
+        [[nodiscard]] auto isoWeek() const -> uint8_t;
+        /**
+         * \brief Returns ISO 8601 week-numbering year, that is the year the ISO week belongs to.
+         * \return uint16_t.
+         */
+        [[nodiscard]] auto isoWeekYear() const -> uint16_t;
         /**
          * \brief Returns if currently set day of the week is weekend.
          * \note Saturday and Sunday are considered as weekend days.
          * \return bool.
          */
         [[nodiscard]] auto isWeekend() const -> bool;
+        /**
+         * \brief Returns number of days passed since 1970-01-01.
+         * \return int64_t.
+         */
+        [[nodiscard]] auto daysSinceEpoch() const -> int64_t;
         /**
          * \brief Checks if year is leap year.
          * \param p_year uint16_t.
@@ -167,6 +300,8 @@ namespace tristan::date {
         [[nodiscard]] static auto isLeapYear(uint16_t p_year) -> bool;
         /**
          * \brief Sets formatter for class aka for all instances.
+         * \note Thread safe: may be called while other threads format values, which see either previous or new formatter.
+         * Empty formatter restores default representation. See GlobalFormatter.
          * \param p_formatter std::function<std::string(const Date&)>
          */
         static void setGlobalFormatter(Formatter&& p_formatter);
@@ -177,26 +312,142 @@ namespace tristan::date {
          */
         void setLocalFormatter(Formatter&& p_formatter);
 
+        /**
+         * \brief Returns true if neither local nor global formatter is set, that is if toString() returns canonical representation.
+         * \return bool.
+         */
+        [[nodiscard]] auto usesDefaultFormatter() const -> bool;
+
         /**
          * \brief Return string representation of date in YYYY-MM-DD format.
          * \return std::string.
          */
         [[nodiscard]] auto toString() const -> std::string;
 
+        /**
+         * \brief Writes canonical [YYYY-MM-DD] representation to [p_first, p_last). Formatters are not used.
+         * \param p_first char*.
+         * \param p_last char*.
+         * \return std::to_chars_result with pointer past the last written character,
+         * or with p_last and std::errc::value_too_large if representation does not fit in which case the range is left untouched.
+         */
+        auto toChars(char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \brief Appends canonical [YYYY-MM-DD] representation to p_string. See toChars.
+         * \param p_string std::string&.
+         */
+        void appendTo(std::string& p_string) const;
+
+        /**
+         * \brief Returns canonical representation stored inline, so no allocation takes place even for the longest representation. See toChars.
+         * \return FixedString<g_date_max_length>.
+         */
+        [[nodiscard]] auto toFixedString() const noexcept -> FixedString< tristan::date::g_date_max_length >;
+
+        /**
+         * \brief Enables or disables table of canonical representations, so that toChars, appendTo, toFixedString and default formatter
+         * copy 10 characters instead of computing day, month and year. Output is the same with and without the table.
+         * Table covers dates between 1900-01-01 and 2155-12-31 and is filled lazily by blocks of 512 days on first access,
+         * so that only blocks of dates which are actually formatted take memory: 5 KB per block, about 1 MB for the whole range.
+         * \note Thread safe. Filled blocks are never released, so the table may be used during static destruction.
+         * Disabling only stops lookups. Disabled by default.
+         * \param p_enabled bool.
+         */
+        static void setTextTableEnabled(bool p_enabled);
+
+        /**
+         * \brief Returns true if table of canonical representations is enabled. See setTextTableEnabled.
+         * \return bool.
+         */
+        [[nodiscard]] static auto isTextTableEnabled() -> bool;
+
+        /**
+         * \brief Return string representation of date in ISO 8601 week date format [YYYY-Www-D], e.g. [2024-W05-3].
+         * \return std::string.
+         */
+        [[nodiscard]] auto toIsoWeekString() const -> std::string;
+        /**
+         * \brief Return string representation of date in ISO 8601 ordinal date format [YYYY-DDD], e.g. [2024-123].
+         * \return std::string.
+         */
+        [[nodiscard]] auto toOrdinalString() const -> std::string;
+
         /**
          * \brief Creates Date object which represents local date.
          * \return Date.
          */
         [[nodiscard]] static auto localDate() -> Date;
 
+        /**
+         * \brief Non-throwing version of Date(std::string_view). Accepts the same formats.
+         * \param p_iso_date std::string_view.
+         * \return Result<Date> which holds either Date or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryParse(std::string_view p_iso_date) noexcept -> Result< Date >;
+
+        /**
+         * \brief Non-throwing version of Date(uint8_t p_day, uint8_t p_month, uint16_t p_year).
+         * \param p_day uint8_t.
+         * \param p_month uint8_t.
+         * \param p_year uint16_t.
+         * \return Result<Date> which holds either Date or ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryCreate(uint8_t p_day, uint8_t p_month, uint16_t p_year) noexcept -> Result< Date >;
+
+        /**
+         * \brief Creates Date from number of days passed since 1970-01-01. Reverse of daysSinceEpoch().
+         * \param p_days_since_epoch int64_t.
+         * \return Result<Date> which holds either Date or ErrorCode::OUT_OF_RANGE if date is before 1900-01-01 or after 2155-12-31.
+         */
+        [[nodiscard]] static auto fromDaysSinceEpoch(int64_t p_days_since_epoch) noexcept -> Result< Date >;
+
+        /**
+         * \brief Creates Date from ISO 8601 week date.
+         * \param p_iso_week_date const IsoWeekDate&.
+         * \return Result<Date> which holds either Date or ErrorCode::OUT_OF_RANGE, e.g. for week 53 of the year which has 52 weeks
+         * or for the date outside of 1900-01-01 - 2155-12-31.
+         */
+        [[nodiscard]] static auto fromIsoWeekDate(const IsoWeekDate& p_iso_week_date) noexcept -> Result< Date >;
+
+        /**
+         * \brief Creates Date from year and day of the year.
+         * \param p_year uint16_t.
+         * \param p_day_of_the_year uint16_t.
+         * \return Result<Date> which holds either Date or ErrorCode::OUT_OF_RANGE, e.g. if year is not between 1900 and 2155.
+         */
+        [[nodiscard]] static auto fromOrdinal(uint16_t p_year, uint16_t p_day_of_the_year) noexcept -> Result< Date >;
+
+        /**
+         * \brief Parses ISO 8601 week date [YYYY-Www-D] or [YYYYWwwD].
+         * \param p_iso_week_date std::string_view.
+         * \return Result<Date> which holds either Date or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryParseIsoWeek(std::string_view p_iso_week_date) noexcept -> Result< Date >;
+
+        /**
+         * \brief Parses ISO 8601 ordinal date [YYYY-DDD] or [YYYYDDD].
+         * \param p_ordinal_date std::string_view.
+         * \return Result<Date> which holds either Date or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryParseOrdinal(std::string_view p_ordinal_date) noexcept -> Result< Date >;
+
     protected:
     private:
-        inline static Formatter m_formatter_global;
+        inline static GlobalFormatter< Formatter > m_formatter_global;
 
         Formatter m_formatter_local;
 
         Days m_days_since_1900;
 
+        explicit Date(Days p_days_since_1900) noexcept;
+
+        void _setDate(uint8_t p_day, uint8_t p_month, uint16_t p_year) noexcept;
+        /**
+         * \brief Assigns value of p_other, local formatter is kept.
+         */
+        void _assignValue(const Date& p_other) noexcept;
+
         [[nodiscard]] auto _calculateCurrentMonth() const -> uint8_t;
         [[nodiscard]] auto _calculateCurrentYear() const -> uint8_t;
         [[nodiscard]] auto _calculateDayOfTheMonth() const -> uint8_t;
@@ -236,9 +487,21 @@ namespace tristan::date {
      * \param out std::ostream&
      * \param date const Date&
      * \return std::ostream&
-     * \note Method toString() is used here
+     * \note Canonical representation is formatted on the stack and inserted without allocation, width and fill flags of the stream are applied.
+     * If formatter is set, result of toString() is inserted instead.
      */
     auto operator<<(std::ostream& out, const Date& date) -> std::ostream&;
+    /**
+     * \brief Operator >>
+     * Reads characters which may belong to Date string representation ([YYYY-MM-DD] or [YYYYMMDD]) directly from the stream buffer, without intermediate strings,
+     * and parses them. Leading whitespace is skipped if std::ios_base::skipws is set, the same way as numeric extractors do.
+     * \param in std::istream&
+     * \param date Date&. Value is assigned only if parsing succeeds, local formatter is kept.
+     * \return std::istream&
+     * Reading stops at the first character which can not continue valid representation, e.g. [2024-01-01-2024-02-01] holds two dates.
+     * \note std::ios_base::failbit is set if representation is malformed, std::ios_base::eofbit is set if end of stream is reached.
+     */
+    auto operator>>(std::istream& in, Date& date) -> std::istream&;
 
 }  //namespace tristan::date
 #endif  // DATE_HPP
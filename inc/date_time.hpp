@@ -14,11 +14,27 @@ namespace tristan::date_time {
      */
     using Formatter = std::function< std::string(const DateTime&) >;
 
+    /**
+     * \brief Maximal length of canonical representation written by DateTime::toChars.
+     */
+    inline constexpr size_t g_date_time_max_length = tristan::date::g_date_max_length + 1 + tristan::time::g_time_max_length;
+
+    /**
+     * \brief Enum which represents implementations of ISO string parser.
+     */
+    enum class ParserBackend : uint8_t {
+        AUTO,
+        SCALAR,
+        SIMD
+    };
+
     /**
      * \brief Class to store date and day time
      * \headerfile date_time.hpp
      */
     class DateTime {
+        friend auto operator>>(std::istream& in, DateTime& dt) -> std::istream&;
+
     public:
         /**
          * \brief Default constructor.
@@ -52,8 +68,18 @@ namespace tristan::date_time {
          * \li [YYYY-MM-DDTHH:MM:SS.mmm.mmm.nnn]
          * \li [YYYYMMDDTHH:MM:SS.mmm.mmm.nnn+(-)HH]
          * \li [YYYY-MM-DDTHH:MM:SS.mmm.mmm.nnn+(-)HH]
+         * \note No heap allocation is performed. Date and time parts are handed over to Date and Time parsers as views of the original buffer.
+         * \note Equivalent to parse(p_date_time, ParserBackend::AUTO) which is a throwing wrapper around tryParse.
+         * \throws std::runtime_error - if date and time delimiter is missing.
+         * \throws std::invalid_argument, std::range_error - see Date and Time string constructors.
+         */
+        explicit DateTime(std::string_view p_date_time);
+        /**
+         * \brief Creates DateTime from already constructed date and time.
+         * \param p_date date::Date&&
+         * \param p_time time::Time&&
          */
-        explicit DateTime(const std::string& p_date_time);
+        DateTime(date::Date&& p_date, time::Time&& p_time);
         /**
          * \brief Copy constructor
          */
@@ -180,6 +206,11 @@ namespace tristan::date_time {
          * \return const time::Time&
          */
         [[nodiscard]] auto time() const -> const time::Time&;
+        /**
+         * \brief Returns time passed since 1970-01-01T00:00:00 UTC, that is offset is subtracted.
+         * \return std::chrono::nanoseconds
+         */
+        [[nodiscard]] auto sinceEpoch() const -> std::chrono::nanoseconds;
 
         /**
          * \brief Sets formatter for object of class Time.
@@ -196,6 +227,8 @@ namespace tristan::date_time {
 
         /**
          * \brief Sets formatter for class aka for all instances.
+         * \note Thread safe: may be called while other threads format values, which see either previous or new formatter.
+         * Empty formatter restores default representation. See GlobalFormatter.
          * \param p_formatter std::function<std::string(const DateTime&)>
          */
         static void setGlobalFormatter(Formatter&& p_formatter);
@@ -205,25 +238,101 @@ namespace tristan::date_time {
          * \param p_formatter std::function<std::string(const DateTime&)>
          */
         void setLocalFormatter(Formatter&& p_formatter);
+        /**
+         * \brief Returns true if no formatter is set for DateTime, its Date and its Time, that is if toString() returns canonical representation.
+         * \return bool.
+         */
+        [[nodiscard]] auto usesDefaultFormatter() const -> bool;
         /**
          * \brief Generates string representation of time. Returns [Date::toString][T][Time::toString]
          * \return std::string
          */
         [[nodiscard]] auto toString() const -> std::string;
 
+        /**
+         * \brief Writes canonical [YYYY-MM-DDTHH:MM...+HH] representation to [p_first, p_last) in one pass. Formatters are not used.
+         * \param p_first char*.
+         * \param p_last char*.
+         * \return std::to_chars_result with pointer past the last written character,
+         * or with p_last and std::errc::value_too_large if representation does not fit in which case the range is left untouched.
+         */
+        auto toChars(char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \brief Appends canonical representation to p_string. See toChars.
+         * \param p_string std::string&.
+         */
+        void appendTo(std::string& p_string) const;
+
+        /**
+         * \brief Returns canonical representation stored inline, so no allocation takes place even for the longest representation. See toChars.
+         * \return FixedString<g_date_time_max_length>.
+         */
+        [[nodiscard]] auto toFixedString() const noexcept -> FixedString< g_date_time_max_length >;
+
         /**
          * \brief Creates Date object which represents local date.
          * \return DateTime.
          */
         [[nodiscard]] static auto localDateTime() -> DateTime;
 
+        /**
+         * \brief Parses date and time string representation using specified parser implementation.
+         * Accepts the same formats as DateTime(std::string_view).
+         * \param p_date_time std::string_view.
+         * \param p_backend ParserBackend. AUTO selects SIMD parser if it is available and SCALAR otherwise.
+         * \note SIMD parser validates the whole record at once and falls back to scalar parser if record is rejected,
+         * so both implementations produce exactly the same results and throw exactly the same exceptions.
+         * If SIMD parser is not available SIMD backend is silently replaced with SCALAR one.
+         * \return DateTime.
+         * \throws std::runtime_error, std::invalid_argument, std::range_error.
+         */
+        [[nodiscard]] static auto parse(std::string_view p_date_time, ParserBackend p_backend = ParserBackend::AUTO) -> DateTime;
+        /**
+         * \brief Non-throwing version of parse(std::string_view, ParserBackend).
+         * \param p_date_time std::string_view.
+         * \param p_backend ParserBackend.
+         * \return Result<DateTime> which holds either DateTime or ErrorCode::MISSING_DELIMITER, ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryParse(std::string_view p_date_time, ParserBackend p_backend = ParserBackend::AUTO) noexcept -> Result< DateTime >;
+        /**
+         * \brief Creates DateTime from time passed since 1970-01-01T00:00:00 UTC. Reverse of sinceEpoch().
+         * \param p_since_epoch std::chrono::nanoseconds.
+         * \param p_precision tristan::time::Precision. Part which is finer than precision is dropped.
+         * \param p_offset tristan::TimeZone. Offset of the local date and time which are stored in the object.
+         * \return Result<DateTime> which holds either DateTime or ErrorCode::OUT_OF_RANGE if local date is before 1900-01-01 or after 2155-12-31.
+         */
+        [[nodiscard]] static auto fromSinceEpoch(std::chrono::nanoseconds p_since_epoch,
+                                                 tristan::time::Precision p_precision,
+                                                 tristan::TimeZone p_offset = tristan::TimeZone::UTC) noexcept -> Result< DateTime >;
+        /**
+         * \brief Creates DateTime from local date and time and offset with minute resolution, e.g. parsed from [+05:30].
+         * \param p_date date::Date&&
+         * \param p_time time::Time&&. Offset of the time is replaced.
+         * \param p_offset std::chrono::minutes.
+         * \return Result<DateTime> which holds either DateTime or ErrorCode::OUT_OF_RANGE if converted date is before 1900-01-01 or after 2155-12-31.
+         * \note Offsets which can not be represented by TimeZone (non zero minutes or more than 12 hours) are converted to UTC,
+         * so that the time point is preserved.
+         */
+        [[nodiscard]] static auto fromLocal(date::Date&& p_date, time::Time&& p_time, std::chrono::minutes p_offset) noexcept -> Result< DateTime >;
+        /**
+         * \brief Returns whether library was built with SSSE3 (or above) instruction set enabled, that is if SIMD parser is available.
+         * \return bool.
+         */
+        [[nodiscard]] static auto simdParserAvailable() -> bool;
+
     protected:
     private:
-        inline static Formatter m_formatter_global;
+        inline static GlobalFormatter< Formatter > m_formatter_global;
         Formatter m_formatter_local;
 
         date::Date m_date;
         time::Time m_time;
+
+        /**
+         * \brief Assigns value of p_other, local formatters of the object and of its date and time are kept.
+         */
+        void _assignValue(const DateTime& p_other) noexcept;
     };
 
     /**
@@ -259,9 +368,21 @@ namespace tristan::date_time {
      * \param out std::ostream&
      * \param dt const DateTime&
      * \return std::ostream&
-     * \note Method toString() is used here
+     * \note Canonical representation is formatted on the stack and inserted without allocation, width and fill flags of the stream are applied.
+     * If formatter is set, result of toString() is inserted instead.
      */
     auto operator<<(std::ostream& out, const DateTime& dt) -> std::ostream&;
+    /**
+     * \brief Operator >>
+     * Reads characters which may belong to DateTime string representation (see DateTime(std::string_view)) directly from the stream buffer, without intermediate strings,
+     * and parses them. Leading whitespace is skipped if std::ios_base::skipws is set, the same way as numeric extractors do.
+     * \param in std::istream&
+     * \param dt DateTime&. Value is assigned only if parsing succeeds, local formatters are kept.
+     * \return std::istream&
+     * Reading stops at the first character which can not continue valid representation, e.g. [2024-01-01-2024-02-01] holds two dates.
+     * \note std::ios_base::failbit is set if representation is malformed, std::ios_base::eofbit is set if end of stream is reached.
+     */
+    auto operator>>(std::istream& in, DateTime& dt) -> std::istream&;
 
 }  // namespace tristan::date_time
 
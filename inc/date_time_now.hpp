@@ -0,0 +1,52 @@
+#ifndef DATE_TIME_NOW_HPP
+#define DATE_TIME_NOW_HPP
+
+#include "date_time.hpp"
+
+/**
+ * \brief Formatted current date and time for logging hot paths.
+ * Part up to seconds is rendered at most once per second and cached per thread, so that in the common case the call costs one clock read
+ * and writing of fraction digits. Output is canonical representation, see DateTime::toChars.
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Writes representation of the current local date and time, that is DateTime::localDateTime() with p_precision.
+     * Offset is taken from localtime_r, as std::localtime shares its result between threads, and is refreshed together with the cached seconds.
+     * \param p_first char*.
+     * \param p_last char*.
+     * \param p_precision time::Precision.
+     * \return std::to_chars_result with pointer past the last written character,
+     * or with p_last and std::errc::value_too_large if range is too short, or with p_last and std::errc::result_out_of_range
+     * if the clock is out of range of Date. In case of error range is left untouched.
+     */
+    auto writeLocalDateTimeNow(char* p_first, char* p_last, time::Precision p_precision = time::Precision::MILLISECONDS) noexcept -> std::to_chars_result;
+
+    /**
+     * \brief Writes representation of the current UTC date and time, that is DateTime() with p_precision. See writeLocalDateTimeNow.
+     * \param p_first char*.
+     * \param p_last char*.
+     * \param p_precision time::Precision.
+     * \return std::to_chars_result.
+     */
+    auto writeUtcDateTimeNow(char* p_first, char* p_last, time::Precision p_precision = time::Precision::MILLISECONDS) noexcept -> std::to_chars_result;
+
+    /**
+     * \brief Returns representation of the current local date and time. See writeLocalDateTimeNow.
+     * \note Returned view points to thread local buffer and is valid until the next call of localDateTimeNow on the same thread.
+     * \param p_precision time::Precision.
+     * \return std::string_view. Empty if the clock is out of range of Date.
+     */
+    [[nodiscard]] auto localDateTimeNow(time::Precision p_precision = time::Precision::MILLISECONDS) noexcept -> std::string_view;
+
+    /**
+     * \brief Returns representation of the current UTC date and time. See writeUtcDateTimeNow.
+     * \note Returned view points to thread local buffer and is valid until the next call of utcDateTimeNow on the same thread.
+     * \param p_precision time::Precision.
+     * \return std::string_view. Empty if the clock is out of range of Date.
+     */
+    [[nodiscard]] auto utcDateTimeNow(time::Precision p_precision = time::Precision::MILLISECONDS) noexcept -> std::string_view;
+
+}  // namespace tristan::date_time
+
+#endif  // DATE_TIME_NOW_HPP
@@ -0,0 +1,77 @@
+#ifndef EPOCH_TEXT_HPP
+#define EPOCH_TEXT_HPP
+
+#include "date_time.hpp"
+
+#include <span>
+
+/**
+ * \brief Text representation of time passed since 1970-01-01T00:00:00 UTC, e.g. [1697040000.123456789].
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Enum which represents unit of the integral part of epoch text.
+     */
+    enum class EpochUnit : uint8_t {
+        SECONDS,
+        MILLISECONDS,
+        MICROSECONDS,
+        NANOSECONDS
+    };
+
+    /**
+     * \brief Maximum length of epoch text: sign, 19 integral digits, point and 9 fraction digits.
+     */
+    inline constexpr size_t g_epoch_text_max_length = 30;
+
+    /**
+     * \brief Parses epoch text [-IIIIIIIIII.fffffffff] where integral part is in p_unit and fraction has 1 to 9 digits.
+     * Digits are converted eight at a time and no floating point arithmetic is involved, so that the value is exact.
+     * Part of the fraction which is finer than a nanosecond is truncated.
+     * \param p_epoch_text std::string_view.
+     * \param p_unit EpochUnit.
+     * \return Result<DateTime> with UTC offset, or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+     * Precision is the coarsest one which holds the parsed value resolution,
+     * e.g. SECONDS for [1697040000], MILLISECONDS for [1697040000.1] and [1697040000123], NANOSECONDS for [1697040000.1234567].
+     */
+    [[nodiscard]] auto tryParseEpoch(std::string_view p_epoch_text, EpochUnit p_unit = EpochUnit::SECONDS) noexcept -> Result< DateTime >;
+
+    /**
+     * \brief Parses epoch text into std::chrono::nanoseconds. See tryParseEpoch.
+     * \param p_epoch_text std::string_view.
+     * \param p_unit EpochUnit.
+     * \return Result<std::chrono::nanoseconds>.
+     */
+    [[nodiscard]] auto tryParseEpochSinceEpoch(std::string_view p_epoch_text, EpochUnit p_unit = EpochUnit::SECONDS) noexcept
+        -> Result< std::chrono::nanoseconds >;
+
+    /**
+     * \brief Writes epoch text of the date and time.
+     * \param p_date_time const DateTime&.
+     * \param p_unit EpochUnit.
+     * \param p_fraction_digits uint8_t in range 0 - 9. Digits beyond nanosecond resolution are written as zeros. No point is written if 0.
+     * \param p_buffer std::span<char, g_epoch_text_max_length>.
+     * \return size_t number of characters written.
+     * \throws std::invalid_argument if p_fraction_digits is greater than 9.
+     */
+    auto writeEpoch(const DateTime& p_date_time, EpochUnit p_unit, uint8_t p_fraction_digits, std::span< char, g_epoch_text_max_length > p_buffer)
+        -> size_t;
+
+    /**
+     * \brief Returns epoch text of the date and time with as many fraction digits as precision of the date and time requires in p_unit.
+     * \param p_date_time const DateTime&.
+     * \param p_unit EpochUnit.
+     * \return std::string.
+     */
+    [[nodiscard]] auto toEpochString(const DateTime& p_date_time, EpochUnit p_unit = EpochUnit::SECONDS) -> std::string;
+
+    /**
+     * \overload
+     * \param p_fraction_digits uint8_t in range 0 - 9.
+     */
+    [[nodiscard]] auto toEpochString(const DateTime& p_date_time, EpochUnit p_unit, uint8_t p_fraction_digits) -> std::string;
+
+}  // namespace tristan::date_time
+
+#endif  // EPOCH_TEXT_HPP
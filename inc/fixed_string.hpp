@@ -0,0 +1,93 @@
+#ifndef FIXED_STRING_HPP
+#define FIXED_STRING_HPP
+
+#include <array>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace tristan {
+
+    /**
+     * \brief String of at most N characters which is stored inline, so it can be returned by value without heap allocation.
+     * Returned by toFixedString functions. Content is not null terminated.
+     * \tparam N Capacity.
+     * \headerfile fixed_string.hpp
+     */
+    template < size_t N > class FixedString {
+    public:
+        /**
+         * \brief Creates empty string.
+         */
+        constexpr FixedString() noexcept = default;
+
+        /**
+         * \brief Returns pointer to the first character.
+         * \return char*
+         */
+        [[nodiscard]] constexpr auto data() noexcept -> char* { return m_buffer.data(); }
+
+        /**
+         * \overload
+         */
+        [[nodiscard]] constexpr auto data() const noexcept -> const char* { return m_buffer.data(); }
+
+        /**
+         * \brief Returns number of characters.
+         * \return size_t
+         */
+        [[nodiscard]] constexpr auto size() const noexcept -> size_t { return m_size; }
+
+        /**
+         * \brief Returns true if string has no characters.
+         * \return bool
+         */
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool { return m_size == 0; }
+
+        /**
+         * \brief Returns maximal number of characters.
+         * \return size_t
+         */
+        [[nodiscard]] static constexpr auto capacity() noexcept -> size_t { return N; }
+
+        /**
+         * \brief Sets number of characters, e.g. after writing to data(). Has to be not greater than capacity().
+         * \param p_size size_t
+         */
+        constexpr void resize(size_t p_size) noexcept { m_size = p_size; }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const char* { return m_buffer.data(); }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const char* { return m_buffer.data() + m_size; }
+
+        /**
+         * \brief Returns view of the content. View is valid as long as the object is alive.
+         * \return std::string_view
+         */
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view { return {m_buffer.data(), m_size}; }
+
+        constexpr operator std::string_view() const noexcept { return view(); }
+
+        /**
+         * \brief Copies content to std::string.
+         * \return std::string
+         */
+        [[nodiscard]] auto str() const -> std::string { return std::string(view()); }
+
+        friend constexpr auto operator==(const FixedString& l, std::string_view r) noexcept -> bool { return l.view() == r; }
+
+    protected:
+    private:
+        std::array< char, N > m_buffer;
+        size_t m_size = 0;
+    };
+
+    template < size_t N > auto operator<<(std::ostream& out, const FixedString< N >& p_string) -> std::ostream& {
+        out << p_string.view();
+        return out;
+    }
+
+}  // namespace tristan
+
+#endif  // FIXED_STRING_HPP
@@ -0,0 +1,85 @@
+#ifndef FORMAT_DETECTOR_HPP
+#define FORMAT_DETECTOR_HPP
+
+#include "date_time.hpp"
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Enum which represents timestamp layouts recognised by FormatDetector.
+     */
+    enum class TimestampFormat : uint8_t {
+        UNKNOWN,
+        /// [YYYYMMDDTHH:MM...] - see DateTime(std::string_view).
+        ISO_BASIC,
+        /// [YYYY-MM-DDTHH:MM...] - see DateTime(std::string_view).
+        ISO_EXTENDED,
+        /// [YYYY-MM-DD HH:MM:SS] with optional fraction of 1 to 9 digits [.fffffffff]. UTC is assumed.
+        SQL,
+        /// [YYYY-MM-DDTHH:MM:SS] with optional fraction of 1 to 9 digits and [Z] or [+(-)HH:MM] offset.
+        RFC_3339,
+        /// [-SSSSSSSSSS] seconds since 1970-01-01T00:00:00 UTC with optional fraction of 1 to 9 digits.
+        EPOCH_SECONDS
+    };
+
+    /**
+     * \brief Parser for heterogeneous inputs which classifies timestamp by its length and separator positions
+     * and dispatches it to the parser of the detected format.
+     * Object remembers the last successfully parsed format, so that in the common case of a stream with single format detection is skipped.
+     * \par Precision of SQL, RFC_3339 and EPOCH_SECONDS formats is selected by number of fraction digits:
+     * SECONDS if there is no fraction, MILLISECONDS for 1 to 3, MICROSECONDS for 4 to 6 and NANOSECONDS for 7 to 9 digits.
+     * \note See DateTime::fromLocal for offsets which can not be represented by TimeZone.
+     * \note Object is not thread safe. Use one detector per stream.
+     * \headerfile format_detector.hpp
+     */
+    class FormatDetector {
+    public:
+        /**
+         * \brief Creates detector without remembered format.
+         */
+        FormatDetector() = default;
+
+        /**
+         * \brief Classifies timestamp. Record is not validated, so returned format is only the candidate.
+         * \param p_timestamp std::string_view.
+         * \return TimestampFormat.
+         */
+        [[nodiscard]] static auto detect(std::string_view p_timestamp) noexcept -> TimestampFormat;
+
+        /**
+         * \brief Parses timestamp as the specified format.
+         * \param p_timestamp std::string_view.
+         * \param p_format TimestampFormat.
+         * \return Result<DateTime> which holds either DateTime or ErrorCode. UNKNOWN format results in ErrorCode::INVALID_FORMAT.
+         */
+        [[nodiscard]] static auto tryParseAs(std::string_view p_timestamp, TimestampFormat p_format) noexcept -> Result< DateTime >;
+
+        /**
+         * \brief Parses timestamp with the last successfully parsed format and detects the format if it does not match.
+         * \param p_timestamp std::string_view.
+         * \return Result<DateTime> which holds either DateTime or error of the parser of detected format.
+         */
+        [[nodiscard]] auto tryParse(std::string_view p_timestamp) noexcept -> Result< DateTime >;
+
+        /**
+         * \brief Throwing version of tryParse(std::string_view).
+         * \param p_timestamp std::string_view.
+         * \return DateTime.
+         * \throws std::runtime_error, std::invalid_argument, std::range_error.
+         */
+        [[nodiscard]] auto parse(std::string_view p_timestamp) -> DateTime;
+
+        /**
+         * \brief Returns the last successfully parsed format.
+         * \return TimestampFormat. UNKNOWN if nothing was parsed yet.
+         */
+        [[nodiscard]] auto lastFormat() const -> TimestampFormat { return m_last_format; }
+
+    protected:
+    private:
+        TimestampFormat m_last_format = TimestampFormat::UNKNOWN;
+    };
+
+}  // namespace tristan::date_time
+
+#endif  // FORMAT_DETECTOR_HPP
@@ -0,0 +1,369 @@
+#ifndef FORMAT_PATTERN_HPP
+#define FORMAT_PATTERN_HPP
+
+#include "date_time.hpp"
+#include "calendar_names.hpp"
+
+#include <array>
+#include <charconv>
+#include <stdexcept>
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Output layout which is compiled once from strftime like format string into flat list of steps.
+     * Value is decoded into fields once and written in a single pass, so formatting does not go through accessors of Date and Time.
+     * \par Conversions:
+     * \li %Y - year, 4 digits.
+     * \li %m - month, 2 digits.
+     * \li %d - day of the month, 2 digits.
+     * \li %j - day of the year, 3 digits.
+     * \li %a - abbreviated day name of the locale, e.g. [Sun].
+     * \li %A - day name of the locale, e.g. [Sunday].
+     * \li %b - abbreviated month name of the locale, e.g. [Jan].
+     * \li %B - month name of the locale, e.g. [January].
+     * \li %H, %M, %S - hours, minutes and seconds, 2 digits each.
+     * \li %f - fraction of the second with 3, 6 or 9 digits according to precision of the value. Zeros are written for coarser precisions.
+     * \li %3f, %6f, %9f - fraction of the second with fixed number of digits, finer digits are truncated.
+     * \li %z - offset in [+(-)HH] form.
+     * \li %F - same as %Y-%m-%d.
+     * \li %T - same as %H:%M:%S.
+     * \li %% - '%' character.
+     * \li Any other character is written as is.
+     * \note FormatPattern is a literal type, so it may be declared constexpr in which case invalid format string is a compile time error.
+     * \note Names are taken from built in tables of CalendarNames, so localized output costs the same as numeric one
+     * and std::locale is not involved.
+     * \par Example:
+     * \code
+     * constexpr tristan::date_time::FormatPattern g_log_format("%Y%m%d %H:%M:%S.%f");
+     * tristan::date_time::DateTime::setGlobalFormatter(g_log_format.toFormatter());
+     * constexpr tristan::date_time::FormatPattern g_report_format("%A %d %B %Y", tristan::date_time::Locale::FRENCH);  // [samedi 17 octobre 2026]
+     * \endcode
+     * \headerfile format_pattern.hpp
+     */
+    class FormatPattern {
+    public:
+        /**
+         * \brief Maximum number of steps (conversions and literal characters) of the pattern.
+         */
+        static constexpr size_t max_steps = 48;
+
+        /**
+         * \brief Maximum length of the output of any pattern, that is max_steps of the longest step: 9 digits fraction or the longest name.
+         */
+        static constexpr size_t max_length = max_steps * std::max(size_t{9}, g_calendar_name_max_length);
+
+        /**
+         * \brief Compiles format string.
+         * \param p_format std::string_view.
+         * \param p_locale Locale. Language of month and day names.
+         * \throws std::invalid_argument - if format string has unsupported conversion or is longer than max_steps.
+         */
+        constexpr explicit FormatPattern(std::string_view p_format, Locale p_locale = Locale::ENGLISH) :
+            m_steps{},
+            m_names(&calendarNames(p_locale)),
+            m_steps_count(0),
+            m_max_length(0),
+            m_uses_date(false),
+            m_uses_time(false),
+            m_uses_day_of_the_year(false) {
+            for (size_t l_pos = 0; l_pos < p_format.size(); ++l_pos) {
+                if (p_format[l_pos] != '%') {
+                    _addStep(Field::LITERAL, p_format[l_pos]);
+                    continue;
+                }
+                if (++l_pos == p_format.size()) {
+                    throw std::invalid_argument("tristan::date_time::FormatPattern: Format ends with '%'");
+                }
+                switch (p_format[l_pos]) {
+                    case 'Y': {
+                        _addStep(Field::YEAR);
+                        break;
+                    }
+                    case 'm': {
+                        _addStep(Field::MONTH);
+                        break;
+                    }
+                    case 'd': {
+                        _addStep(Field::DAY);
+                        break;
+                    }
+                    case 'j': {
+                        _addStep(Field::DAY_OF_THE_YEAR);
+                        break;
+                    }
+                    case 'a': {
+                        _addStep(Field::DAY_ABBREVIATION);
+                        break;
+                    }
+                    case 'A': {
+                        _addStep(Field::DAY_NAME);
+                        break;
+                    }
+                    case 'b': {
+                        _addStep(Field::MONTH_ABBREVIATION);
+                        break;
+                    }
+                    case 'B': {
+                        _addStep(Field::MONTH_NAME);
+                        break;
+                    }
+                    case 'H': {
+                        _addStep(Field::HOURS);
+                        break;
+                    }
+                    case 'M': {
+                        _addStep(Field::MINUTES);
+                        break;
+                    }
+                    case 'S': {
+                        _addStep(Field::SECONDS);
+                        break;
+                    }
+                    case 'f': {
+                        _addStep(Field::FRACTION, 0);
+                        break;
+                    }
+                    case '3':
+                    case '6':
+                    case '9': {
+                        if (l_pos + 1 == p_format.size() || p_format[l_pos + 1] != 'f') {
+                            throw std::invalid_argument("tristan::date_time::FormatPattern: Digits count has to be followed by 'f'");
+                        }
+                        _addStep(Field::FRACTION, static_cast< char >(p_format[l_pos++] - '0'));
+                        break;
+                    }
+                    case 'z': {
+                        _addStep(Field::OFFSET);
+                        break;
+                    }
+                    case 'F': {
+                        _addStep(Field::YEAR);
+                        _addStep(Field::LITERAL, '-');
+                        _addStep(Field::MONTH);
+                        _addStep(Field::LITERAL, '-');
+                        _addStep(Field::DAY);
+                        break;
+                    }
+                    case 'T': {
+                        _addStep(Field::HOURS);
+                        _addStep(Field::LITERAL, ':');
+                        _addStep(Field::MINUTES);
+                        _addStep(Field::LITERAL, ':');
+                        _addStep(Field::SECONDS);
+                        break;
+                    }
+                    case '%': {
+                        _addStep(Field::LITERAL, '%');
+                        break;
+                    }
+                    default: {
+                        throw std::invalid_argument("tristan::date_time::FormatPattern: Unsupported conversion");
+                    }
+                }
+            }
+        }
+
+        /**
+         * \brief Returns maximal length of the output.
+         * \return size_t
+         */
+        [[nodiscard]] constexpr auto maxLength() const -> size_t { return m_max_length; }
+
+        /**
+         * \brief Returns true if pattern has date conversions.
+         * \return bool
+         */
+        [[nodiscard]] constexpr auto usesDate() const -> bool { return m_uses_date; }
+
+        /**
+         * \brief Returns true if pattern has time conversions.
+         * \return bool
+         */
+        [[nodiscard]] constexpr auto usesTime() const -> bool { return m_uses_time; }
+
+        /**
+         * \brief Writes formatted value to [p_first, p_last).
+         * \param p_date_time const DateTime&.
+         * \param p_first char*.
+         * \param p_last char*.
+         * \return std::to_chars_result with pointer past the last written character,
+         * or with p_last and std::errc::value_too_large if output may not fit, that is if range is shorter than maxLength().
+         */
+        auto write(const DateTime& p_date_time, char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \overload
+         * \return std::to_chars_result with p_last and std::errc::invalid_argument if pattern has time conversions.
+         */
+        auto write(const date::Date& p_date, char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \overload
+         * \return std::to_chars_result with p_last and std::errc::invalid_argument if pattern has date conversions.
+         */
+        auto write(const time::Time& p_time, char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \brief Returns formatted value.
+         * \param p_date_time const DateTime&.
+         * \return std::string.
+         */
+        [[nodiscard]] auto format(const DateTime& p_date_time) const -> std::string;
+
+        /**
+         * \overload
+         * \throws std::invalid_argument - if pattern has time conversions.
+         */
+        [[nodiscard]] auto format(const date::Date& p_date) const -> std::string;
+
+        /**
+         * \overload
+         * \throws std::invalid_argument - if pattern has date conversions.
+         */
+        [[nodiscard]] auto format(const time::Time& p_time) const -> std::string;
+
+        /**
+         * \brief Returns formatter which may be installed with DateTime::setGlobalFormatter or DateTime::setLocalFormatter.
+         * \return Formatter.
+         */
+        [[nodiscard]] auto toFormatter() const -> Formatter;
+
+        /**
+         * \brief Returns formatter which may be installed with Date::setGlobalFormatter or Date::setLocalFormatter.
+         * \return date::Formatter.
+         * \throws std::invalid_argument - if pattern has time conversions.
+         */
+        [[nodiscard]] auto toDateFormatter() const -> date::Formatter;
+
+        /**
+         * \brief Returns formatter which may be installed with Time::setGlobalFormatter or Time::setLocalFormatter.
+         * \return time::Formatter.
+         * \throws std::invalid_argument - if pattern has date conversions.
+         */
+        [[nodiscard]] auto toTimeFormatter() const -> time::Formatter;
+
+    protected:
+    private:
+        enum class Field : uint8_t {
+            YEAR,
+            MONTH,
+            DAY,
+            DAY_OF_THE_YEAR,
+            DAY_ABBREVIATION,
+            DAY_NAME,
+            MONTH_ABBREVIATION,
+            MONTH_NAME,
+            HOURS,
+            MINUTES,
+            SECONDS,
+            FRACTION,
+            OFFSET,
+            LITERAL
+        };
+
+        /**
+         * \brief Output step: field or single literal character. For FRACTION argument is number of digits, 0 meaning digits of the precision.
+         */
+        struct Step {
+            Field field;
+            char argument;
+        };
+
+        /**
+         * \brief Value decoded once for all steps.
+         */
+        struct Fields {
+            date::CivilDate date;
+            uint16_t day_of_the_year;
+            uint8_t day_of_the_week;
+            uint32_t seconds_since_day_start;
+            uint32_t fraction_nanoseconds;
+            time::Precision precision;
+            int8_t offset;
+        };
+
+        std::array< Step, max_steps > m_steps;
+        const CalendarNames* m_names;
+        uint8_t m_steps_count;
+        uint16_t m_max_length;
+        bool m_uses_date;
+        bool m_uses_time;
+        bool m_uses_day_of_the_year;
+
+        constexpr void _addStep(Field p_field, char p_argument = 0) {
+            if (m_steps_count == max_steps) {
+                throw std::invalid_argument("tristan::date_time::FormatPattern: Format is too long");
+            }
+            m_steps[m_steps_count++] = Step{p_field, p_argument};
+            switch (p_field) {
+                case Field::YEAR: {
+                    m_max_length = static_cast< uint16_t >(m_max_length + 4);
+                    break;
+                }
+                case Field::DAY_OF_THE_YEAR:
+                case Field::OFFSET: {
+                    m_max_length = static_cast< uint16_t >(m_max_length + 3);
+                    break;
+                }
+                case Field::DAY_ABBREVIATION:
+                case Field::DAY_NAME:
+                case Field::MONTH_ABBREVIATION:
+                case Field::MONTH_NAME: {
+                    m_max_length = static_cast< uint16_t >(m_max_length + _maxNameLength(p_field));
+                    break;
+                }
+                case Field::FRACTION: {
+                    m_max_length = static_cast< uint16_t >(m_max_length + (p_argument == 0 ? 9 : p_argument));
+                    break;
+                }
+                case Field::LITERAL: {
+                    m_max_length = static_cast< uint16_t >(m_max_length + 1);
+                    break;
+                }
+                default: {
+                    m_max_length = static_cast< uint16_t >(m_max_length + 2);
+                    break;
+                }
+            }
+            m_uses_day_of_the_year = m_uses_day_of_the_year || p_field == Field::DAY_OF_THE_YEAR;
+            m_uses_date = m_uses_date || p_field < Field::HOURS;
+            m_uses_time = m_uses_time || (p_field >= Field::HOURS && p_field != Field::LITERAL);
+        }
+
+        [[nodiscard]] constexpr auto _maxNameLength(Field p_field) const -> size_t {
+            size_t l_length = 0;
+            const auto l_update = [&l_length](const auto& p_names) {
+                for (const auto l_name: p_names) {
+                    l_length = std::max(l_length, l_name.size());
+                }
+            };
+            switch (p_field) {
+                case Field::DAY_ABBREVIATION: {
+                    l_update(m_names->weekday_abbreviations);
+                    break;
+                }
+                case Field::DAY_NAME: {
+                    l_update(m_names->weekdays);
+                    break;
+                }
+                case Field::MONTH_ABBREVIATION: {
+                    l_update(m_names->month_abbreviations);
+                    break;
+                }
+                default: {
+                    l_update(m_names->months);
+                    break;
+                }
+            }
+            return l_length;
+        }
+
+        void _decodeDate(const date::Date& p_date, Fields& p_fields) const noexcept;
+        static void _decodeTime(const time::Time& p_time, Fields& p_fields) noexcept;
+        [[nodiscard]] auto _write(const Fields& p_fields, char* p_buffer) const noexcept -> char*;
+    };
+
+}  // namespace tristan::date_time
+
+#endif  // FORMAT_PATTERN_HPP
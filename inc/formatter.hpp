@@ -0,0 +1,195 @@
+#ifndef FORMATTER_HPP
+#define FORMATTER_HPP
+
+#include "format_pattern.hpp"
+
+#include <algorithm>
+#include <version>
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Format specification of std::formatter specializations for Date, Time and DateTime.
+     * Kept independent of <format> so that it may be used with any formatting library which passes specification as a string.
+     * \par Specification:
+     * \li Empty - canonical representation, see DateTime::toChars.
+     * \li .N - canonical representation with N (0, 3, 6 or 9) fraction digits, that is SECONDS, MILLISECONDS, MICROSECONDS or NANOSECONDS precision.
+     * Finer digits are truncated. Not applicable to Date.
+     * \li %... - layout of FormatPattern, e.g. {:%Y%m%d %H:%M:%S.%f}.
+     * \headerfile formatter.hpp
+     */
+    class FormatSpec {
+    public:
+        /**
+         * \brief Maximum length of the output of any specification.
+         */
+        static constexpr size_t max_length = FormatPattern::max_length;
+
+        /**
+         * \brief Creates specification of canonical representation.
+         */
+        constexpr FormatSpec() :
+            m_pattern(""),
+            m_has_pattern(false),
+            m_has_precision(false),
+            m_precision(time::Precision::MINUTES) { }
+
+        /**
+         * \brief Parses specification, that is the part of replacement field after ':'.
+         * \param p_spec std::string_view.
+         * \param p_locale Locale. Language of month and day names of FormatPattern layout.
+         * \throws std::invalid_argument - if specification is malformed.
+         */
+        constexpr explicit FormatSpec(std::string_view p_spec, Locale p_locale = Locale::ENGLISH) :
+            FormatSpec() {
+            if (p_spec.empty()) {
+                return;
+            }
+            if (p_spec[0] == '%') {
+                m_pattern = FormatPattern(p_spec, p_locale);
+                m_has_pattern = true;
+                return;
+            }
+            if (p_spec.size() != 2 || p_spec[0] != '.') {
+                throw std::invalid_argument("tristan::date_time::FormatSpec: Specification has to be empty, .N or FormatPattern layout");
+            }
+            m_has_precision = true;
+            switch (p_spec[1]) {
+                case '0': {
+                    m_precision = time::Precision::SECONDS;
+                    break;
+                }
+                case '3': {
+                    m_precision = time::Precision::MILLISECONDS;
+                    break;
+                }
+                case '6': {
+                    m_precision = time::Precision::MICROSECONDS;
+                    break;
+                }
+                case '9': {
+                    m_precision = time::Precision::NANOSECONDS;
+                    break;
+                }
+                default: {
+                    throw std::invalid_argument("tristan::date_time::FormatSpec: Precision has to be 0, 3, 6 or 9");
+                }
+            }
+        }
+
+        /**
+         * \brief Returns true if specification has date conversions.
+         * \return bool
+         */
+        [[nodiscard]] constexpr auto usesDate() const -> bool { return m_has_pattern && m_pattern.usesDate(); }
+
+        /**
+         * \brief Returns true if specification has time conversions or precision.
+         * \return bool
+         */
+        [[nodiscard]] constexpr auto usesTime() const -> bool { return m_has_precision || (m_has_pattern && m_pattern.usesTime()); }
+
+        /**
+         * \brief Writes formatted value to [p_first, p_last).
+         * \param p_date_time const DateTime&.
+         * \param p_first char*.
+         * \param p_last char*.
+         * \return std::to_chars_result. See DateTime::toChars and FormatPattern::write.
+         */
+        auto write(const DateTime& p_date_time, char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \overload
+         */
+        auto write(const date::Date& p_date, char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \overload
+         */
+        auto write(const time::Time& p_time, char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \brief Writes formatted value to output iterator. Value is formatted to stack buffer, so nothing is allocated.
+         * \tparam T Date, Time or DateTime.
+         * \tparam OutputIterator Iterator of char.
+         * \param p_value const T&.
+         * \param p_out OutputIterator.
+         * \return OutputIterator past the last written character.
+         */
+        template < typename T, typename OutputIterator > auto formatTo(const T& p_value, OutputIterator p_out) const -> OutputIterator {
+            std::array< char, max_length > l_buffer;
+            const auto l_result = write(p_value, l_buffer.data(), l_buffer.data() + l_buffer.size());
+            return std::copy(l_buffer.data(), l_result.ptr, p_out);
+        }
+
+    protected:
+    private:
+        FormatPattern m_pattern;
+        bool m_has_pattern;
+        bool m_has_precision;
+        time::Precision m_precision;
+    };
+
+}  // namespace tristan::date_time
+
+#if __has_include(<format>)
+  #include <format>
+#endif
+
+#if defined(__cpp_lib_format)
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Common part of std::formatter specializations.
+     * \tparam T Date, Time or DateTime.
+     */
+    template < typename T > struct StdFormatterBase {
+        FormatSpec spec;
+
+        template < typename ParseContext > constexpr auto parse(ParseContext& p_context) -> typename ParseContext::iterator {
+            auto l_end = std::find(p_context.begin(), p_context.end(), '}');
+            try {
+                spec = FormatSpec(std::string_view(p_context.begin(), l_end));
+            } catch (const std::invalid_argument& l_error) {
+                throw std::format_error(l_error.what());
+            }
+            if constexpr (std::is_same_v< T, date::Date >) {
+                if (spec.usesTime()) {
+                    throw std::format_error("tristan::date::Date formatter: Specification has time conversions");
+                }
+            }
+            if constexpr (std::is_same_v< T, time::Time >) {
+                if (spec.usesDate()) {
+                    throw std::format_error("tristan::time::Time formatter: Specification has date conversions");
+                }
+            }
+            return l_end;
+        }
+
+        template < typename FormatContext > auto format(const T& p_value, FormatContext& p_context) const -> typename FormatContext::iterator {
+            return spec.formatTo(p_value, p_context.out());
+        }
+    };
+
+}  // namespace tristan::date_time
+
+/**
+ * \brief Allows std::format("{}", date), std::format("{:%d.%m.%Y}", date). See tristan::date_time::FormatSpec.
+ */
+template <> struct std::formatter< tristan::date::Date, char > : tristan::date_time::StdFormatterBase< tristan::date::Date > { };
+
+/**
+ * \brief Allows std::format("{}", time), std::format("{:.3}", time), std::format("{:%H:%M}", time). See tristan::date_time::FormatSpec.
+ */
+template <> struct std::formatter< tristan::time::Time, char > : tristan::date_time::StdFormatterBase< tristan::time::Time > { };
+
+/**
+ * \brief Allows std::format("{}", date_time), std::format("{:.0}", date_time), std::format("{:%F %T}", date_time).
+ * See tristan::date_time::FormatSpec.
+ */
+template <> struct std::formatter< tristan::date_time::DateTime, char > : tristan::date_time::StdFormatterBase< tristan::date_time::DateTime > { };
+
+#endif  // __cpp_lib_format
+
+#endif  // FORMATTER_HPP
@@ -0,0 +1,214 @@
+#ifndef GLOBAL_FORMATTER_HPP
+#define GLOBAL_FORMATTER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace tristan {
+
+    /**
+     * \brief Formatter shared by all instances of a class which may be replaced while other threads format values.
+     * Reading does not lock: installed state is published as generation word, which is a single acquire load when formatter is
+     * not set. Every thread caches reference to installed formatter and takes the mutex only to refresh it after set().
+     * \note Replaced formatter is destroyed when the last thread which cached it formats value again or exits, so each thread
+     * holds at most one outdated formatter and hot swapping does not accumulate memory. Thread which calls set() releases its
+     * own reference immediately. std::atomic<std::shared_ptr> is not used, as libstdc++ 12 implementation of load() is reported
+     * as data race by ThreadSanitizer.
+     * \note Constant initialized, so it may be used during static initialization of other translation units. Installed formatter is
+     * never destroyed on program exit, so values may be formatted from static destructors and from threads which outlive main().
+     * \tparam F Formatter type, std::function<std::string(const T&)>.
+     * \headerfile global_formatter.hpp
+     */
+    template < typename F > class GlobalFormatter {
+        struct Cache;
+
+    public:
+        /**
+         * \brief Installed formatter leased to the calling thread. Valid until destroyed, even if formatter is replaced meanwhile.
+         */
+        class Lease {
+        public:
+            Lease(const Lease&) = delete;
+
+            Lease(Lease&& p_other) noexcept :
+                m_formatter(p_other.m_formatter),
+                m_cache(p_other.m_cache),
+                m_owner(std::move(p_other.m_owner)) {
+                p_other.m_cache = nullptr;
+            }
+
+            ~Lease() {
+                if (m_cache != nullptr) {
+                    --m_cache->depth;
+                }
+            }
+
+            auto operator=(const Lease&) -> Lease& = delete;
+            auto operator=(Lease&&) -> Lease& = delete;
+
+            /**
+             * \brief Checks if formatter is set.
+             */
+            explicit operator bool() const noexcept { return m_formatter != nullptr; }
+
+            auto operator*() const noexcept -> const F& { return *m_formatter; }
+
+        protected:
+        private:
+            friend class GlobalFormatter;
+
+            Lease() noexcept = default;
+
+            Lease(const F* p_formatter, Cache* p_cache) noexcept :
+                m_formatter(p_formatter),
+                m_cache(p_cache) {
+                ++m_cache->depth;
+            }
+
+            explicit Lease(std::shared_ptr< const F > p_owner) noexcept :
+                m_formatter(p_owner.get()),
+                m_owner(std::move(p_owner)) { }
+
+            const F* m_formatter = nullptr;
+            Cache* m_cache = nullptr;
+            std::shared_ptr< const F > m_owner;
+        };
+
+        /**
+         * \brief Creates object without formatter, that is default formatting is used.
+         */
+        constexpr GlobalFormatter() noexcept :
+            m_generation(0),
+            m_state() { }
+
+        GlobalFormatter(const GlobalFormatter&) = delete;
+        GlobalFormatter(GlobalFormatter&&) = delete;
+
+        // m_state is intentionally not destroyed, see class description.
+        ~GlobalFormatter() { }
+
+        auto operator=(const GlobalFormatter&) -> GlobalFormatter& = delete;
+        auto operator=(GlobalFormatter&&) -> GlobalFormatter& = delete;
+
+        /**
+         * \brief Checks if formatter is installed.
+         */
+        [[nodiscard]] auto installed() const noexcept -> bool { return (m_generation.load(std::memory_order_acquire) & g_installed) != 0; }
+
+        /**
+         * \brief Returns installed formatter.
+         * \return Lease, empty if formatter is not set.
+         * \note Formatter which is running on the calling thread is not released, even if it formats values recursively or replaces itself.
+         */
+        [[nodiscard]] auto get() const -> Lease {
+            const auto l_generation = m_generation.load(std::memory_order_acquire);
+            if ((l_generation & g_installed) == 0) {
+                return Lease();
+            }
+            auto& l_cache = GlobalFormatter::_threadCache();
+            if (l_cache.owner != this || l_cache.generation != l_generation) {
+                if (l_cache.depth != 0 || l_cache.closed) {
+                    // Cached formatter is running on this thread and can not be released or the thread is exiting.
+                    return Lease(_current());
+                }
+                _refresh(l_cache);
+            }
+            if (l_cache.formatter == nullptr) {
+                return Lease();
+            }
+            return Lease(l_cache.formatter, &l_cache);
+        }
+
+        /**
+         * \brief Installs formatter. Threads which format values concurrently use either previous or new formatter.
+         * \param p_formatter F&&. Empty formatter restores default formatting.
+         */
+        void set(F&& p_formatter) {
+            std::shared_ptr< const F > l_next;
+            if (p_formatter) {
+                l_next = std::make_shared< const F >(std::move(p_formatter));
+            }
+            const uint64_t l_installed = l_next ? g_installed : 0;
+            {
+                std::scoped_lock l_lock(m_state.mutex);
+                m_state.current.swap(l_next);
+                const auto l_generation = (m_generation.load(std::memory_order_relaxed) & ~g_installed) + 2;
+                m_generation.store(l_generation | l_installed, std::memory_order_release);
+            }
+            if (auto& l_cache = GlobalFormatter::_threadCache(); l_cache.owner == this && l_cache.depth == 0) {
+                l_cache = Cache();
+                GlobalFormatter::_keeper().formatter.reset();
+            }
+            // Previous formatter is released here, outside of the lock, or by the last thread which still caches it.
+        }
+
+    protected:
+    private:
+        // Lowest bit of generation is set while formatter is installed, the rest counts calls to set().
+        static constexpr uint64_t g_installed = 1;
+
+        // Trivially destructible, so reading it does not need initialization guard.
+        struct Cache {
+            const GlobalFormatter* owner = nullptr;
+            uint64_t generation = 0;
+            const F* formatter = nullptr;
+            uint32_t depth = 0;
+            bool closed = false;
+        };
+
+        // Owns formatter cached by the thread, accessed only when cache is refreshed.
+        struct Keeper {
+            std::shared_ptr< const F > formatter;
+
+            ~Keeper() {
+                auto& l_cache = GlobalFormatter::_threadCache();
+                l_cache = Cache();
+                l_cache.closed = true;
+            }
+        };
+
+        struct State {
+            std::shared_ptr< const F > current;
+            std::mutex mutex;
+        };
+
+        std::atomic< uint64_t > m_generation;
+
+        union {
+            mutable State m_state;
+        };
+
+        static auto _threadCache() noexcept -> Cache& {
+            thread_local Cache l_cache;
+            return l_cache;
+        }
+
+        static auto _keeper() -> Keeper& {
+            thread_local Keeper l_keeper;
+            return l_keeper;
+        }
+
+        void _refresh(Cache& p_cache) const {
+            auto& l_keeper = GlobalFormatter::_keeper();
+            auto l_previous = std::move(l_keeper.formatter);
+            {
+                std::scoped_lock l_lock(m_state.mutex);
+                l_keeper.formatter = m_state.current;
+                p_cache.generation = m_generation.load(std::memory_order_relaxed);
+            }
+            p_cache.formatter = l_keeper.formatter.get();
+            p_cache.owner = this;
+            // Previous formatter is released outside of the lock, as its destructor may install another one.
+        }
+
+        [[nodiscard]] auto _current() const -> std::shared_ptr< const F > {
+            std::scoped_lock l_lock(m_state.mutex);
+            return m_state.current;
+        }
+    };
+
+}  // namespace tristan
+
+#endif  // GLOBAL_FORMATTER_HPP
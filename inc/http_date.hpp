@@ -0,0 +1,52 @@
+#ifndef HTTP_DATE_HPP
+#define HTTP_DATE_HPP
+
+#include "date_time.hpp"
+
+#include <span>
+
+/**
+ * \brief HTTP-date (RFC 7231 IMF-fixdate) support, e.g. [Sun, 06 Nov 1994 08:49:37 GMT].
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Length of IMF-fixdate representation.
+     */
+    inline constexpr size_t g_http_date_length = 29;
+
+    /**
+     * \brief Parses IMF-fixdate.
+     * \param p_http_date std::string_view.
+     * \return Result<DateTime> with SECONDS precision and UTC offset, or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+     * \note Day name has to be valid but is not checked against the date, as recommended for HTTP recipients.
+     */
+    [[nodiscard]] auto tryParseHttpDate(std::string_view p_http_date) noexcept -> Result< DateTime >;
+
+    /**
+     * \brief Writes IMF-fixdate representation of the date and time. Date and time is converted to GMT, part finer than seconds is dropped.
+     * \param p_date_time const DateTime&.
+     * \param p_buffer std::span<char, g_http_date_length>.
+     */
+    void writeHttpDate(const DateTime& p_date_time, std::span< char, g_http_date_length > p_buffer);
+
+    /**
+     * \brief Returns IMF-fixdate representation of the date and time. See writeHttpDate.
+     * \param p_date_time const DateTime&.
+     * \return std::string.
+     */
+    [[nodiscard]] auto toHttpDate(const DateTime& p_date_time) -> std::string;
+
+    /**
+     * \brief Returns IMF-fixdate representation of the current time, e.g. for Date header.
+     * Value is formatted once per second and shared by all threads, every thread copies it once per second to its own buffer,
+     * so that in the common case the call costs a clock read and a comparison.
+     * \note Thread safe. Returned view refers to thread local buffer: it stays valid and unchanged until the next call on the same thread
+     * and must not be passed to other threads.
+     * \return std::string_view.
+     */
+    [[nodiscard]] auto httpDateNow() -> std::string_view;
+
+}  // namespace tristan::date_time
+
+#endif  // HTTP_DATE_HPP
@@ -0,0 +1,93 @@
+#ifndef INCREMENTAL_PARSER_HPP
+#define INCREMENTAL_PARSER_HPP
+
+#include "date_time.hpp"
+
+#include <array>
+#include <optional>
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Stateful parser for streams of date and time string representations where consecutive records usually share the same date
+     * and often the same hours and minutes, e.g. log files.
+     * The parser remembers the date prefix ([YYYY-MM-DDT] or [YYYYMMDDT]) and [HH:MM] of the last accepted record. If the incoming record starts
+     * with the same characters only the changed suffix is decoded, otherwise the whole record is parsed as by DateTime::tryParse.
+     * \note Accepts the same formats and produces exactly the same results and errors as DateTime::tryParse.
+     * \note Object is not thread safe. Use one parser per stream.
+     * \headerfile incremental_parser.hpp
+     */
+    class IncrementalParser {
+    public:
+        /**
+         * \brief Creates parser with empty state.
+         * \param p_backend ParserBackend which is used when the whole record has to be parsed.
+         */
+        explicit IncrementalParser(ParserBackend p_backend = ParserBackend::AUTO);
+
+        /**
+         * \brief Parses date and time string representation reusing the state of the previously accepted record.
+         * \param p_date_time std::string_view.
+         * \return Result<DateTime> which holds either DateTime or ErrorCode::MISSING_DELIMITER, ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         * \note Rejected records do not change the state.
+         */
+        [[nodiscard]] auto tryParse(std::string_view p_date_time) noexcept -> Result< DateTime >;
+
+        /**
+         * \brief Throwing version of tryParse(std::string_view).
+         * \param p_date_time std::string_view.
+         * \return DateTime.
+         * \throws std::runtime_error, std::invalid_argument, std::range_error - see DateTime::parse.
+         */
+        [[nodiscard]] auto parse(std::string_view p_date_time) -> DateTime;
+
+        /**
+         * \brief Parses date and time string representation into time passed since 1970-01-01T00:00:00 UTC, see DateTime::sinceEpoch().
+         * If date and [HH:MM] prefixes are the same as in the previously accepted record no DateTime object is created,
+         * so the cost is close to comparison of the prefix and conversion of the remaining digits.
+         * \param p_date_time std::string_view.
+         * \return Result<std::chrono::nanoseconds> which holds either time since epoch or the same error as tryParse(std::string_view).
+         */
+        [[nodiscard]] auto tryParseSinceEpoch(std::string_view p_date_time) noexcept -> Result< std::chrono::nanoseconds >;
+
+        /**
+         * \brief Drops remembered prefixes so that the next record is parsed in full.
+         */
+        void reset() noexcept;
+
+    protected:
+    private:
+        /**
+         * \brief Validated fields of the time which follow [HH:MM].
+         */
+        struct TimeSuffix {
+            time::Precision precision;
+            uint8_t seconds;
+            uint16_t milliseconds;
+            uint16_t microseconds;
+            uint16_t nanoseconds;
+            TimeZone offset;
+        };
+
+        std::optional< date::Date > m_date;
+        int64_t m_days_since_epoch;
+        std::array< char, 11 > m_date_prefix;
+        uint8_t m_date_prefix_length;
+
+        std::array< char, 5 > m_minute_prefix;
+        bool m_minute_prefix_set;
+        uint8_t m_hours;
+        uint8_t m_minutes;
+
+        ParserBackend m_backend;
+
+        [[nodiscard]] auto _matchesDatePrefix(std::string_view p_date_time) const noexcept -> bool;
+        [[nodiscard]] auto _tryParseTimeSuffix(std::string_view p_time) const noexcept -> std::optional< TimeSuffix >;
+        [[nodiscard]] auto _tryParseTime(std::string_view p_time) noexcept -> Result< time::Time >;
+        void _rememberDate(std::string_view p_date_time, const date::Date& p_date) noexcept;
+        void _rememberMinute(std::string_view p_time, const time::Time& p_parsed_time) noexcept;
+    };
+
+}  // namespace tristan::date_time
+
+#endif  // INCREMENTAL_PARSER_HPP
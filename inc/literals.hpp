@@ -0,0 +1,281 @@
+#ifndef LITERALS_HPP
+#define LITERALS_HPP
+
+#include "date_time.hpp"
+
+#include <stdexcept>
+
+namespace tristan::literals {
+
+    /**
+     * \brief Parses fixed width field of decimal digits of compile time literal.
+     * \param p_text std::string_view.
+     * \param p_pos size_t.
+     * \param p_width size_t.
+     * \return uint32_t.
+     */
+    [[nodiscard]] consteval auto parseDigits(std::string_view p_text, size_t p_pos, size_t p_width) -> uint32_t {
+        uint32_t l_value = 0;
+        for (size_t l_index = p_pos; l_index < p_pos + p_width; ++l_index) {
+            if (p_text[l_index] < '0' || p_text[l_index] > '9') {
+                throw std::invalid_argument("Literal has non digit character where digit is expected");
+            }
+            l_value = l_value * 10 + static_cast< uint32_t >(p_text[l_index] - '0');
+        }
+        return l_value;
+    }
+
+}  // namespace tristan::literals
+
+namespace tristan::date {
+
+    /**
+     * \brief Literal type which holds date validated at compile time. Produced by operator""_date and converted to Date when needed.
+     * \note Date itself can not be constant initialized as it holds formatter, so this type is used to keep constants free of runtime initialization.
+     * \headerfile literals.hpp
+     */
+    class DateLiteral {
+    public:
+        /**
+         * \brief Parses date in the formats accepted by Date(std::string_view): [YYYY-MM-DD] or [YYYYMMDD].
+         * \param p_iso_date std::string_view.
+         * \return DateLiteral.
+         * \note Malformed input and date outside of 1900-01-01 - 2155-12-31 fail compilation.
+         */
+        [[nodiscard]] static consteval auto parse(std::string_view p_iso_date) -> DateLiteral {
+            const bool l_extended = p_iso_date.size() == 10;
+            if (not l_extended && p_iso_date.size() != 8) {
+                throw std::invalid_argument("Date literal has to be in [YYYY-MM-DD] or [YYYYMMDD] format");
+            }
+            if (l_extended && (p_iso_date[4] != '-' || p_iso_date[7] != '-')) {
+                throw std::invalid_argument("Date literal has to be in [YYYY-MM-DD] or [YYYYMMDD] format");
+            }
+            const auto l_year = static_cast< uint16_t >(tristan::literals::parseDigits(p_iso_date, 0, 4));
+            const auto l_month = static_cast< uint8_t >(tristan::literals::parseDigits(p_iso_date, l_extended ? 5 : 4, 2));
+            const auto l_day = static_cast< uint8_t >(tristan::literals::parseDigits(p_iso_date, l_extended ? 8 : 6, 2));
+            const bool l_leap_year = l_year % 4 == 0 && (l_year % 100 != 0 || l_year % 400 == 0);
+            uint8_t l_days_in_month = 31;
+            if (l_month == 4 || l_month == 6 || l_month == 9 || l_month == 11) {
+                l_days_in_month = 30;
+            } else if (l_month == 2) {
+                l_days_in_month = l_leap_year ? 29 : 28;
+            }
+            if (l_year < g_min_year || l_year > g_max_year || l_month < 1 || l_month > 12 || l_day < 1 || l_day > l_days_in_month) {
+                throw std::range_error("Date literal is out of range");
+            }
+            return DateLiteral(daysFromCivil(l_day, l_month, l_year));
+        }
+
+        /**
+         * \brief Returns number of days passed since 1970-01-01.
+         * \return int64_t.
+         */
+        [[nodiscard]] constexpr auto daysSinceEpoch() const -> int64_t { return m_days_since_epoch; }
+
+        /**
+         * \brief Converts literal to Date.
+         */
+        operator Date() const { return Date::fromDaysSinceEpoch(m_days_since_epoch).value(); }
+
+    protected:
+    private:
+        int64_t m_days_since_epoch;
+
+        constexpr explicit DateLiteral(int64_t p_days_since_epoch) :
+            m_days_since_epoch(p_days_since_epoch) { }
+    };
+
+}  // namespace tristan::date
+
+namespace tristan::time {
+
+    /**
+     * \brief Literal type which holds time validated at compile time. Produced by operator""_time and converted to Time when needed.
+     * \headerfile literals.hpp
+     */
+    class TimeLiteral {
+    public:
+        /**
+         * \brief Parses time in the formats accepted by Time(std::string_view), e.g. [HH:MM], [HH:MM:SS.mmm] or [HH:MM:SS.mmm.mmm.nnn+HH].
+         * \param p_time std::string_view.
+         * \return TimeLiteral.
+         * \note Malformed input fails compilation.
+         */
+        [[nodiscard]] static consteval auto parse(std::string_view p_time) -> TimeLiteral {
+            int8_t l_offset = 0;
+            if (p_time.size() > 3 && (p_time[p_time.size() - 3] == '+' || p_time[p_time.size() - 3] == '-')) {
+                const auto l_offset_hours = static_cast< int8_t >(tristan::literals::parseDigits(p_time, p_time.size() - 2, 2));
+                if (l_offset_hours > static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+                    throw std::range_error("Time literal offset is out of range");
+                }
+                l_offset = p_time[p_time.size() - 3] == '-' ? static_cast< int8_t >(-l_offset_hours) : l_offset_hours;
+                p_time.remove_suffix(3);
+            }
+            Precision l_precision = Precision::MINUTES;
+            switch (p_time.size()) {
+                case 5: {
+                    break;
+                }
+                case 8: {
+                    l_precision = Precision::SECONDS;
+                    break;
+                }
+                case 12: {
+                    l_precision = Precision::MILLISECONDS;
+                    break;
+                }
+                case 16: {
+                    l_precision = Precision::MICROSECONDS;
+                    break;
+                }
+                case 20: {
+                    l_precision = Precision::NANOSECONDS;
+                    break;
+                }
+                default: {
+                    throw std::invalid_argument("Time literal has to be in [HH:MM[:SS[.mmm[.mmm[.nnn]]]][+(-)HH]] format");
+                }
+            }
+            if (p_time[2] != ':' || (p_time.size() > 5 && p_time[5] != ':')) {
+                throw std::invalid_argument("Time literal has to be in [HH:MM[:SS[.mmm[.mmm[.nnn]]]][+(-)HH]] format");
+            }
+            const auto l_hours = tristan::literals::parseDigits(p_time, 0, 2);
+            const auto l_minutes = tristan::literals::parseDigits(p_time, 3, 2);
+            const auto l_seconds = p_time.size() > 5 ? tristan::literals::parseDigits(p_time, 6, 2) : 0;
+            if (l_hours > 23 || l_minutes > 59 || l_seconds > 59) {
+                throw std::range_error("Time literal is out of range");
+            }
+            int64_t l_fraction = 0;
+            for (size_t l_pos = 8; l_pos < p_time.size(); l_pos += 4) {
+                if (p_time[l_pos] != '.') {
+                    throw std::invalid_argument("Time literal has to be in [HH:MM[:SS[.mmm[.mmm[.nnn]]]][+(-)HH]] format");
+                }
+                l_fraction = l_fraction * 1000 + tristan::literals::parseDigits(p_time, l_pos + 1, 3);
+            }
+            // Scale fraction to nanoseconds, each missing group is three digits.
+            for (size_t l_group = p_time.size() > 8 ? (p_time.size() - 8) / 4 : 0; l_group < 3; ++l_group) {
+                l_fraction *= 1000;
+            }
+            return TimeLiteral(std::chrono::hours(l_hours) + std::chrono::minutes(l_minutes) + std::chrono::seconds(l_seconds)
+                                   + std::chrono::nanoseconds(l_fraction),
+                               l_precision,
+                               static_cast< tristan::TimeZone >(l_offset));
+        }
+
+        /**
+         * \brief Returns time passed since day start.
+         * \return std::chrono::nanoseconds.
+         */
+        [[nodiscard]] constexpr auto sinceDayStart() const -> std::chrono::nanoseconds { return m_since_day_start; }
+
+        /**
+         * \brief Returns precision.
+         * \return Precision.
+         */
+        [[nodiscard]] constexpr auto precision() const -> Precision { return m_precision; }
+
+        /**
+         * \brief Returns offset.
+         * \return tristan::TimeZone.
+         */
+        [[nodiscard]] constexpr auto offset() const -> tristan::TimeZone { return m_offset; }
+
+        /**
+         * \brief Converts literal to Time.
+         */
+        operator Time() const { return Time::fromSinceDayStart(m_since_day_start, m_precision, m_offset).value(); }
+
+    protected:
+    private:
+        std::chrono::nanoseconds m_since_day_start;
+        Precision m_precision;
+        tristan::TimeZone m_offset;
+
+        constexpr TimeLiteral(std::chrono::nanoseconds p_since_day_start, Precision p_precision, tristan::TimeZone p_offset) :
+            m_since_day_start(p_since_day_start),
+            m_precision(p_precision),
+            m_offset(p_offset) { }
+    };
+
+}  // namespace tristan::time
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Literal type which holds date and time validated at compile time. Produced by operator""_dt and converted to DateTime when needed.
+     * \headerfile literals.hpp
+     */
+    class DateTimeLiteral {
+    public:
+        /**
+         * \brief Parses date and time in the formats accepted by DateTime(std::string_view), that is date and time literals delimited by 'T'.
+         * \param p_date_time std::string_view.
+         * \return DateTimeLiteral.
+         * \note Malformed input fails compilation.
+         */
+        [[nodiscard]] static consteval auto parse(std::string_view p_date_time) -> DateTimeLiteral {
+            const auto l_delimiter = p_date_time.find('T');
+            if (l_delimiter == std::string_view::npos) {
+                throw std::invalid_argument("Date and time literal has to have 'T' delimiter");
+            }
+            return DateTimeLiteral(tristan::date::DateLiteral::parse(p_date_time.substr(0, l_delimiter)),
+                                   tristan::time::TimeLiteral::parse(p_date_time.substr(l_delimiter + 1)));
+        }
+
+        /**
+         * \brief Returns date part.
+         * \return const tristan::date::DateLiteral&.
+         */
+        [[nodiscard]] constexpr auto date() const -> const tristan::date::DateLiteral& { return m_date; }
+
+        /**
+         * \brief Returns time part.
+         * \return const tristan::time::TimeLiteral&.
+         */
+        [[nodiscard]] constexpr auto time() const -> const tristan::time::TimeLiteral& { return m_time; }
+
+        /**
+         * \brief Returns time passed since 1970-01-01T00:00:00 UTC. See DateTime::sinceEpoch().
+         * \return std::chrono::nanoseconds.
+         */
+        [[nodiscard]] constexpr auto sinceEpoch() const -> std::chrono::nanoseconds {
+            return tristan::date::Days{m_date.daysSinceEpoch()} + m_time.sinceDayStart() - std::chrono::hours{static_cast< int8_t >(m_time.offset())};
+        }
+
+        /**
+         * \brief Converts literal to DateTime.
+         */
+        operator DateTime() const { return DateTime(m_date, m_time); }
+
+    protected:
+    private:
+        tristan::date::DateLiteral m_date;
+        tristan::time::TimeLiteral m_time;
+
+        constexpr DateTimeLiteral(tristan::date::DateLiteral p_date, tristan::time::TimeLiteral p_time) :
+            m_date(p_date),
+            m_time(p_time) { }
+    };
+
+}  // namespace tristan::date_time
+
+/**
+ * \brief User defined literals which are validated at compile time, e.g. "2024-01-01"_date, "09:30"_time, "2024-01-01T09:30:00"_dt.
+ */
+namespace tristan::literals {
+
+    [[nodiscard]] consteval auto operator""_date(const char* p_text, size_t p_length) -> tristan::date::DateLiteral {
+        return tristan::date::DateLiteral::parse(std::string_view(p_text, p_length));
+    }
+
+    [[nodiscard]] consteval auto operator""_time(const char* p_text, size_t p_length) -> tristan::time::TimeLiteral {
+        return tristan::time::TimeLiteral::parse(std::string_view(p_text, p_length));
+    }
+
+    [[nodiscard]] consteval auto operator""_dt(const char* p_text, size_t p_length) -> tristan::date_time::DateTimeLiteral {
+        return tristan::date_time::DateTimeLiteral::parse(std::string_view(p_text, p_length));
+    }
+
+}  // namespace tristan::literals
+
+#endif  // LITERALS_HPP
@@ -0,0 +1,63 @@
+#ifndef LOG_TIMESTAMP_HPP
+#define LOG_TIMESTAMP_HPP
+
+#include "date_time.hpp"
+
+/**
+ * \brief Parsers of timestamps used by access logs and syslog.
+ * Parsers work on fixed positions of the original buffer and perform no heap allocation.
+ * Functions which return time since epoch skip construction of DateTime and are intended for bulk scans.
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Parses Common Log Format timestamp [10/Oct/2000:13:55:36 -0700]. Square brackets are optional.
+     * \param p_timestamp std::string_view.
+     * \return Result<DateTime> with SECONDS precision, or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+     * \note See DateTime::fromLocal for offsets which can not be represented by TimeZone.
+     */
+    [[nodiscard]] auto tryParseClf(std::string_view p_timestamp) noexcept -> Result< DateTime >;
+
+    /**
+     * \brief Parses Common Log Format timestamp into time passed since 1970-01-01T00:00:00 UTC. See tryParseClf.
+     * \param p_timestamp std::string_view.
+     * \return Result<std::chrono::nanoseconds>.
+     */
+    [[nodiscard]] auto tryParseClfSinceEpoch(std::string_view p_timestamp) noexcept -> Result< std::chrono::nanoseconds >;
+
+    /**
+     * \brief Parses RFC 3164 (BSD syslog) timestamp [Oct 11 22:14:15]. Day of the month may be padded with space, e.g. [Oct  1 22:14:15].
+     * \param p_timestamp std::string_view.
+     * \param p_reference const date::Date&. Date the record was received or archived at.
+     * As the timestamp has no year, year is selected so that date falls in the range from 11 months before to 1 month after the reference date.
+     * \return Result<DateTime> with SECONDS precision and UTC offset, or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+     */
+    [[nodiscard]] auto tryParseRfc3164(std::string_view p_timestamp, const date::Date& p_reference) noexcept -> Result< DateTime >;
+
+    /**
+     * \brief Parses RFC 3164 timestamp into time passed since 1970-01-01T00:00:00 UTC. See tryParseRfc3164.
+     * \param p_timestamp std::string_view.
+     * \param p_reference const date::Date&.
+     * \return Result<std::chrono::nanoseconds>.
+     */
+    [[nodiscard]] auto tryParseRfc3164SinceEpoch(std::string_view p_timestamp, const date::Date& p_reference) noexcept
+        -> Result< std::chrono::nanoseconds >;
+
+    /**
+     * \brief Parses RFC 5424 syslog timestamp [2003-10-11T22:14:15.003Z], that is RFC 3339 timestamp with upper case delimiters
+     * and at most 6 fraction digits.
+     * \param p_timestamp std::string_view. NILVALUE [-] results in ErrorCode::INVALID_FORMAT.
+     * \return Result<DateTime>. Precision is selected by number of fraction digits, see FormatDetector.
+     */
+    [[nodiscard]] auto tryParseRfc5424(std::string_view p_timestamp) noexcept -> Result< DateTime >;
+
+    /**
+     * \brief Parses RFC 5424 timestamp into time passed since 1970-01-01T00:00:00 UTC. See tryParseRfc5424.
+     * \param p_timestamp std::string_view.
+     * \return Result<std::chrono::nanoseconds>.
+     */
+    [[nodiscard]] auto tryParseRfc5424SinceEpoch(std::string_view p_timestamp) noexcept -> Result< std::chrono::nanoseconds >;
+
+}  // namespace tristan::date_time
+
+#endif  // LOG_TIMESTAMP_HPP
@@ -0,0 +1,222 @@
+#ifndef PATTERN_HPP
+#define PATTERN_HPP
+
+#include "date_time.hpp"
+
+#include <array>
+#include <stdexcept>
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Fixed layout date and time parser which is compiled once from strptime like format string into flat list of parse steps.
+     * \par Tokens:
+     * \li YYYY - year.
+     * \li MM - month, or minutes if previous field token is HH.
+     * \li DD - day of the month.
+     * \li HH - hours.
+     * \li SS - seconds.
+     * \li fff, ffffff, fffffffff - fraction of the second. Defines MILLISECONDS, MICROSECONDS or NANOSECONDS precision respectively.
+     * \li Z - offset in [+(-)HH] form.
+     * \li Any other character is a literal which has to match exactly.
+     * \par Precision is defined by the finest time token: MINUTES if SS is absent, SECONDS if fraction is absent. If the pattern has no time tokens
+     * time is set to 00:00 with MINUTES precision.
+     * \note Pattern is a literal type, so it may be declared constexpr in which case invalid format string is a compile time error.
+     * \par Example:
+     * \code
+     * constexpr tristan::date_time::Pattern g_log_pattern("DD/MM/YYYY HH:MM:SS");
+     * auto l_date_time = g_log_pattern.parse("25/08/2021 23:23:23");
+     * \endcode
+     * \headerfile pattern.hpp
+     */
+    class Pattern {
+    public:
+        /**
+         * \brief Maximum number of steps (fields and literals) of the pattern.
+         */
+        static constexpr size_t max_steps = 48;
+
+        /**
+         * \brief Compiles format string.
+         * \param p_format std::string_view.
+         * \throws std::invalid_argument - if format string has unsupported token, repeated field, misses YYYY, MM or DD,
+         * has time fields without the coarser ones (e.g. SS without HH:MM) or is longer than max_steps.
+         */
+        constexpr explicit Pattern(std::string_view p_format) :
+            m_steps{},
+            m_steps_count(0),
+            m_length(0),
+            m_precision(time::Precision::MINUTES) {
+            bool l_after_hours = false;
+            uint8_t l_fields_mask = 0;
+            size_t l_pos = 0;
+            while (l_pos < p_format.size()) {
+                const char l_char = p_format[l_pos];
+                size_t l_run = 1;
+                while (l_pos + l_run < p_format.size() && p_format[l_pos + l_run] == l_char) {
+                    ++l_run;
+                }
+                Field l_field;
+                switch (l_char) {
+                    case 'Y': {
+                        l_field = _expectWidth(l_run, 4, Field::YEAR);
+                        break;
+                    }
+                    case 'M': {
+                        l_field = _expectWidth(l_run, 2, l_after_hours ? Field::MINUTES : Field::MONTH);
+                        break;
+                    }
+                    case 'D': {
+                        l_field = _expectWidth(l_run, 2, Field::DAY);
+                        break;
+                    }
+                    case 'H': {
+                        l_field = _expectWidth(l_run, 2, Field::HOURS);
+                        break;
+                    }
+                    case 'S': {
+                        l_field = _expectWidth(l_run, 2, Field::SECONDS);
+                        break;
+                    }
+                    case 'f': {
+                        if (l_run != 3 && l_run != 6 && l_run != 9) {
+                            throw std::invalid_argument("tristan::date_time::Pattern: Fraction has to have 3, 6 or 9 digits");
+                        }
+                        l_field = Field::FRACTION;
+                        break;
+                    }
+                    case 'Z': {
+                        l_field = _expectWidth(l_run, 1, Field::OFFSET);
+                        l_run = 3;
+                        break;
+                    }
+                    default: {
+                        _addStep(Field::LITERAL, 1, l_char);
+                        ++l_pos;
+                        continue;
+                    }
+                }
+                const auto l_bit = static_cast< uint8_t >(1U << static_cast< uint8_t >(l_field));
+                if ((l_fields_mask & l_bit) != 0) {
+                    throw std::invalid_argument("tristan::date_time::Pattern: Field is repeated");
+                }
+                l_fields_mask |= l_bit;
+                l_after_hours = l_field == Field::HOURS;
+                _addStep(l_field, static_cast< uint8_t >(l_run), 0);
+                if (l_field == Field::FRACTION) {
+                    m_precision = l_run == 3 ? time::Precision::MILLISECONDS : l_run == 6 ? time::Precision::MICROSECONDS : time::Precision::NANOSECONDS;
+                } else if (l_field == Field::SECONDS && m_precision < time::Precision::SECONDS) {
+                    m_precision = time::Precision::SECONDS;
+                }
+                l_pos += l_field == Field::OFFSET ? 1 : l_run;
+            }
+            auto l_has = [l_fields_mask](Field p_field) {
+                return (l_fields_mask & (1U << static_cast< uint8_t >(p_field))) != 0;
+            };
+            if (not l_has(Field::YEAR) || not l_has(Field::MONTH) || not l_has(Field::DAY)) {
+                throw std::invalid_argument("tristan::date_time::Pattern: YYYY, MM and DD are mandatory");
+            }
+            if (l_has(Field::HOURS) != l_has(Field::MINUTES) || (l_has(Field::SECONDS) && not l_has(Field::MINUTES))
+                || (l_has(Field::FRACTION) && not l_has(Field::SECONDS))) {
+                throw std::invalid_argument("tristan::date_time::Pattern: Time fields are incomplete");
+            }
+        }
+
+        /**
+         * \brief Returns length of the records which match the pattern.
+         * \return size_t
+         */
+        [[nodiscard]] constexpr auto length() const -> size_t { return m_length; }
+
+        /**
+         * \brief Returns precision of Time objects produced by the pattern.
+         * \return time::Precision
+         */
+        [[nodiscard]] constexpr auto precision() const -> time::Precision { return m_precision; }
+
+        /**
+         * \brief Parses record.
+         * \param p_date_time std::string_view.
+         * \return Result<DateTime> which holds either DateTime or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] auto tryParse(std::string_view p_date_time) const noexcept -> Result< DateTime >;
+
+        /**
+         * \brief Throwing version of tryParse(std::string_view).
+         * \param p_date_time std::string_view.
+         * \return DateTime.
+         * \throws std::invalid_argument - if record does not match the pattern.
+         * \throws std::range_error - if record has invalid values.
+         */
+        [[nodiscard]] auto parse(std::string_view p_date_time) const -> DateTime;
+
+        /**
+         * \brief Parses record into time passed since 1970-01-01T00:00:00 UTC without creating DateTime object. See DateTime::sinceEpoch().
+         * \param p_date_time std::string_view.
+         * \return Result<std::chrono::nanoseconds> which holds either time since epoch or the same error as tryParse(std::string_view).
+         */
+        [[nodiscard]] auto tryParseSinceEpoch(std::string_view p_date_time) const noexcept -> Result< std::chrono::nanoseconds >;
+
+    protected:
+    private:
+        enum class Field : uint8_t {
+            YEAR,
+            MONTH,
+            DAY,
+            HOURS,
+            MINUTES,
+            SECONDS,
+            FRACTION,
+            OFFSET,
+            LITERAL
+        };
+
+        /**
+         * \brief Parse step: fixed width field of digits or single literal character.
+         */
+        struct Step {
+            Field field;
+            uint8_t width;
+            char literal;
+        };
+
+        std::array< Step, max_steps > m_steps;
+        uint8_t m_steps_count;
+        uint8_t m_length;
+        time::Precision m_precision;
+
+        [[nodiscard]] static constexpr auto _expectWidth(size_t p_run, size_t p_width, Field p_field) -> Field {
+            if (p_run != p_width) {
+                throw std::invalid_argument("tristan::date_time::Pattern: Unsupported token width");
+            }
+            return p_field;
+        }
+
+        constexpr void _addStep(Field p_field, uint8_t p_width, char p_literal) {
+            if (m_steps_count == max_steps) {
+                throw std::invalid_argument("tristan::date_time::Pattern: Format is too long");
+            }
+            m_steps[m_steps_count++] = Step{p_field, p_width, p_literal};
+            m_length = static_cast< uint8_t >(m_length + p_width);
+        }
+
+        /**
+         * \brief Values decoded by the steps. Ranges are not validated.
+         */
+        struct Fields {
+            uint16_t year;
+            uint8_t month;
+            uint8_t day;
+            uint8_t hours;
+            uint8_t minutes;
+            uint8_t seconds;
+            uint32_t fraction_nanoseconds;
+            int8_t offset;
+        };
+
+        [[nodiscard]] auto _decode(std::string_view p_date_time, Fields& p_fields) const noexcept -> bool;
+    };
+
+}  // namespace tristan::date_time
+
+#endif  // PATTERN_HPP
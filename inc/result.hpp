@@ -0,0 +1,117 @@
+#ifndef RESULT_HPP
+#define RESULT_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace tristan {
+
+    /**
+     * \brief Enum which represents reasons of failure reported by non-throwing functions.
+     */
+    enum class ErrorCode : uint8_t {
+        INVALID_FORMAT,
+        OUT_OF_RANGE,
+        MISSING_DELIMITER
+    };
+
+    /**
+     * \brief Holds either value or ErrorCode. Returned by non-throwing (tryParse, tryCreate) functions.
+     * \tparam T Type of the value
+     * \headerfile result.hpp
+     */
+    template < typename T > class Result {
+    public:
+        /**
+         * \brief Creates Result which holds value.
+         * \param p_value T&&
+         */
+        Result(T&& p_value) :
+            m_result(std::in_place_index< 0 >, std::move(p_value)) { }
+
+        /**
+         * \brief Creates Result which holds error.
+         * \param p_error ErrorCode
+         */
+        Result(ErrorCode p_error) :
+            m_result(std::in_place_index< 1 >, p_error) { }
+
+        /**
+         * \brief Returns true if Result holds value.
+         * \return bool
+         */
+        [[nodiscard]] auto hasValue() const -> bool { return m_result.index() == 0; }
+
+        /**
+         * \brief Returns true if Result holds value.
+         */
+        explicit operator bool() const { return hasValue(); }
+
+        /**
+         * \brief Returns error.
+         * \return ErrorCode
+         * \throws std::bad_variant_access if Result holds value.
+         */
+        [[nodiscard]] auto error() const -> ErrorCode { return std::get< 1 >(m_result); }
+
+        /**
+         * \brief Returns value.
+         * \return T&
+         * \throws std::bad_variant_access if Result holds error.
+         */
+        [[nodiscard]] auto value() & -> T& { return std::get< 0 >(m_result); }
+
+        /**
+         * \overload
+         */
+        [[nodiscard]] auto value() const& -> const T& { return std::get< 0 >(m_result); }
+
+        /**
+         * \overload
+         */
+        [[nodiscard]] auto value() && -> T&& { return std::get< 0 >(std::move(m_result)); }
+
+        auto operator*() & -> T& { return value(); }
+
+        auto operator*() const& -> const T& { return value(); }
+
+        auto operator->() -> T* { return &value(); }
+
+        auto operator->() const -> const T* { return &value(); }
+
+        /**
+         * \brief Returns value or throws exception which corresponds to the error.
+         * \param p_source const char*. Name of the function which is put at the beginning of exception message.
+         * \return T
+         * \throws std::invalid_argument - ErrorCode::INVALID_FORMAT.
+         * \throws std::range_error - ErrorCode::OUT_OF_RANGE.
+         * \throws std::runtime_error - ErrorCode::MISSING_DELIMITER.
+         */
+        [[nodiscard]] auto valueOrThrow(const char* p_source) && -> T {
+            if (hasValue()) {
+                return std::get< 0 >(std::move(m_result));
+            }
+            switch (error()) {
+                case ErrorCode::INVALID_FORMAT: {
+                    throw std::invalid_argument(std::string(p_source) + ": Invalid format");
+                }
+                case ErrorCode::OUT_OF_RANGE: {
+                    throw std::range_error(std::string(p_source) + ": Value is out of range");
+                }
+                case ErrorCode::MISSING_DELIMITER:
+                default: {
+                    throw std::runtime_error(std::string(p_source) + ": Date and time delimiter is missing");
+                }
+            }
+        }
+
+    private:
+        std::variant< T, ErrorCode > m_result;
+    };
+
+}  // namespace tristan
+
+#endif  // RESULT_HPP
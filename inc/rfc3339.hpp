@@ -0,0 +1,61 @@
+#ifndef RFC3339_HPP
+#define RFC3339_HPP
+
+#include "date_time.hpp"
+
+#include <span>
+
+/**
+ * \brief RFC 3339 representation of date and time, e.g. [2021-08-25T23:23:23.123456Z] or [2021-08-25T23:23:23+05:30].
+ */
+namespace tristan::date_time {
+
+    /**
+     * \brief Maximum length of RFC 3339 representation: date, time, 9 fraction digits and [+HH:MM] offset.
+     */
+    inline constexpr size_t g_rfc3339_max_length = 35;
+
+    /**
+     * \brief Parses RFC 3339 date and time [YYYY-MM-DDTHH:MM:SS[.f]Z] or [YYYY-MM-DDTHH:MM:SS[.f]+(-)HH:MM] in a single pass.
+     * Fraction may have 1 to 9 digits, 'T' and 'Z' may be lower case.
+     * \param p_date_time std::string_view.
+     * \return Result<DateTime>, or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+     * Precision is SECONDS if there is no fraction, MILLISECONDS for 1 to 3, MICROSECONDS for 4 to 6 and NANOSECONDS for 7 to 9 digits.
+     * \note See DateTime::fromLocal for offsets which can not be represented by TimeZone.
+     */
+    [[nodiscard]] auto tryParseRfc3339(std::string_view p_date_time) noexcept -> Result< DateTime >;
+
+    /**
+     * \brief Parses RFC 3339 time with offset [HH:MM:SS[.f]Z] or [HH:MM:SS[.f]+(-)HH:MM]. See tryParseRfc3339.
+     * \param p_time std::string_view.
+     * \return Result<time::Time>. ErrorCode::OUT_OF_RANGE is returned for offsets which can not be represented by TimeZone,
+     * as the time can not be converted to UTC without the date.
+     */
+    [[nodiscard]] auto tryParseRfc3339Time(std::string_view p_time) noexcept -> Result< time::Time >;
+
+    /**
+     * \brief Writes RFC 3339 representation of the date and time.
+     * Number of fraction digits is 0, 3, 6 or 9 according to precision, UTC offset is written as [Z].
+     * \param p_date_time const DateTime&.
+     * \param p_buffer std::span<char, g_rfc3339_max_length>.
+     * \return size_t number of characters written.
+     */
+    auto writeRfc3339(const DateTime& p_date_time, std::span< char, g_rfc3339_max_length > p_buffer) -> size_t;
+
+    /**
+     * \brief Returns RFC 3339 representation of the date and time. See writeRfc3339.
+     * \param p_date_time const DateTime&.
+     * \return std::string.
+     */
+    [[nodiscard]] auto toRfc3339(const DateTime& p_date_time) -> std::string;
+
+    /**
+     * \brief Returns RFC 3339 representation of the time with offset, e.g. [12:34:56.123456Z]. See writeRfc3339.
+     * \param p_time const time::Time&.
+     * \return std::string.
+     */
+    [[nodiscard]] auto toRfc3339(const time::Time& p_time) -> std::string;
+
+}  // namespace tristan::date_time
+
+#endif  // RFC3339_HPP
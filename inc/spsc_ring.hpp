@@ -0,0 +1,109 @@
+#ifndef SPSC_RING_HPP
+#define SPSC_RING_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace tristan {
+
+    /**
+     * \brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+     * Positions grow monotonically and are masked by capacity, so full and empty states are distinguished without a spare slot.
+     * Each side keeps its own copy of the other side's position and reloads it only when the ring looks full (empty),
+     * so in the common case push and pop touch only the cache line of their own thread.
+     * \note Nothing is allocated after construction. The object is large, so it is meant to be a member of long living object.
+     * \tparam T Trivially copyable element type.
+     * \tparam Capacity Number of slots, power of two.
+     * \headerfile spsc_ring.hpp
+     */
+    template < typename T, size_t Capacity > class SpscRing {
+        static_assert(std::is_trivially_copyable_v< T >, "SpscRing element has to be trivially copyable");
+        static_assert(Capacity >= 2 && std::has_single_bit(Capacity), "SpscRing capacity has to be power of two");
+
+    public:
+        /**
+         * \brief Number of slots.
+         */
+        static constexpr size_t capacity = Capacity;
+
+        SpscRing() = default;
+        SpscRing(const SpscRing&) = delete;
+        SpscRing(SpscRing&&) = delete;
+
+        ~SpscRing() = default;
+
+        auto operator=(const SpscRing&) -> SpscRing& = delete;
+        auto operator=(SpscRing&&) -> SpscRing& = delete;
+
+        /**
+         * \brief Appends value. Has to be called by producer thread only.
+         * \param p_value const T&.
+         * \return bool. False if ring is full, in which case value is not stored.
+         */
+        auto tryPush(const T& p_value) noexcept -> bool {
+            const size_t l_head = m_head.load(std::memory_order_relaxed);
+            if (l_head - m_cached_tail == Capacity) {
+                m_cached_tail = m_tail.load(std::memory_order_acquire);
+                if (l_head - m_cached_tail == Capacity) {
+                    return false;
+                }
+            }
+            m_slots[l_head & index_mask] = p_value;
+            m_head.store(l_head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * \brief Removes up to p_values.size() oldest values. Has to be called by consumer thread only.
+         * \param p_values std::span<T>. Output.
+         * \return size_t. Number of removed values, 0 if ring is empty.
+         */
+        auto popBatch(std::span< T > p_values) noexcept -> size_t {
+            const size_t l_tail = m_tail.load(std::memory_order_relaxed);
+            if (m_cached_head - l_tail < p_values.size()) {
+                m_cached_head = m_head.load(std::memory_order_acquire);
+            }
+            const size_t l_count = std::min(m_cached_head - l_tail, p_values.size());
+            for (size_t l_index = 0; l_index < l_count; ++l_index) {
+                p_values[l_index] = m_slots[(l_tail + l_index) & index_mask];
+            }
+            m_tail.store(l_tail + l_count, std::memory_order_release);
+            return l_count;
+        }
+
+        /**
+         * \brief Removes the oldest value. Has to be called by consumer thread only.
+         * \param p_value T&. Output.
+         * \return bool. False if ring is empty.
+         */
+        auto tryPop(T& p_value) noexcept -> bool { return popBatch(std::span< T >(&p_value, 1)) == 1; }
+
+        /**
+         * \brief Returns number of stored values. Exact only if neither side is active.
+         * \return size_t.
+         */
+        [[nodiscard]] auto size() const noexcept -> size_t { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+
+    protected:
+    private:
+        static constexpr size_t index_mask = Capacity - 1;
+        static constexpr size_t cache_line = 64;
+
+        // Producer side.
+        alignas(cache_line) std::atomic< size_t > m_head{0};
+        size_t m_cached_tail{0};
+        // Consumer side.
+        alignas(cache_line) std::atomic< size_t > m_tail{0};
+        size_t m_cached_head{0};
+
+        alignas(cache_line) std::array< T, Capacity > m_slots;
+    };
+
+}  // namespace tristan
+
+#endif  // SPSC_RING_HPP
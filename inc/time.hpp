@@ -2,13 +2,22 @@
 #define TIME_HPP
 
 #include "time_zones.hpp"
+#include "result.hpp"
+#include "fixed_string.hpp"
+#include "global_formatter.hpp"
 
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <chrono>
+#include <charconv>
 #include <variant>
 #include <functional>
 
+namespace tristan::date_time {
+    class DateTime;
+}  // namespace tristan::date_time
+
 /**
  * \brief Namespace which includes time handlers
  */
@@ -16,6 +25,11 @@ namespace tristan::time {
 
     class Time;
 
+    /**
+     * \brief Maximal length of canonical representation written by Time::toChars, that is [HH:MM:SS.mmm.mmm.nnn+HH].
+     */
+    inline constexpr size_t g_time_max_length = 23;
+
     /**
      * \brief Type definition for function signature which is used to format output
      */
@@ -39,6 +53,8 @@ namespace tristan::time {
     class Time {
         friend auto operator+(const Time& l, const Time& r) -> Time;
         friend auto operator-(const Time& l, const Time& r) -> Time;
+        friend auto operator>>(std::istream& in, Time& time) -> std::istream&;
+        friend class tristan::date_time::DateTime;
 
     public:
         /**
@@ -122,9 +138,11 @@ namespace tristan::time {
          * \li [HH:MM:SS.mmm.mmm+(-)HH] - Microseconds precision with offset.
          * \li [HH:MM:SS.mmm.mmm.nnn] - Nanoseconds precision.
          * \li [HH:MM:SS.mmm.mmm.nnn+(-)HH] - Nanoseconds precision with offset.
+         * \note No heap allocation is performed. Any contiguous character range may be passed: std::string, string literal or buffer pointer with length.
+         * \note This is a throwing wrapper around tryParse(std::string_view).
          * \throws std::invali_argument, std::range_error.
          */
-        explicit Time(const std::string& time);
+        explicit Time(std::string_view p_time);
         /**
          * \brief Copy constructor
          */
@@ -277,6 +295,11 @@ namespace tristan::time {
          * \return uint16_t
          */
         [[nodiscard]] auto nanoseconds() const -> uint16_t;
+        /**
+         * \brief Returns time passed since day start. Offset is not taken into account.
+         * \return std::chrono::nanoseconds
+         */
+        [[nodiscard]] auto sinceDayStart() const -> std::chrono::nanoseconds;
         /**
          * \brief Returns precision of Time object.
          * \return Precision
@@ -295,8 +318,47 @@ namespace tristan::time {
          */
         [[nodiscard]] static auto localTime(Precision p_precision = Precision::SECONDS) -> Time;
 
+        /**
+         * \brief Non-throwing version of Time(std::string_view). Accepts the same formats.
+         * \param p_time std::string_view.
+         * \return Result<Time> which holds either Time or ErrorCode::INVALID_FORMAT, ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryParse(std::string_view p_time) noexcept -> Result< Time >;
+
+        /**
+         * \brief Non-throwing version of component constructors.
+         * \param p_precision Precision. Components which are finer than precision are validated and dropped.
+         * \param p_hours uint8_t.
+         * \param p_minutes uint8_t.
+         * \param p_seconds uint8_t.
+         * \param p_milliseconds uint16_t.
+         * \param p_microseconds uint16_t.
+         * \param p_nanoseconds uint16_t.
+         * \return Result<Time> which holds either Time with UTC offset or ErrorCode::OUT_OF_RANGE.
+         */
+        [[nodiscard]] static auto tryCreate(Precision p_precision,
+                                            uint8_t p_hours,
+                                            uint8_t p_minutes,
+                                            uint8_t p_seconds = 0,
+                                            uint16_t p_milliseconds = 0,
+                                            uint16_t p_microseconds = 0,
+                                            uint16_t p_nanoseconds = 0) noexcept -> Result< Time >;
+
+        /**
+         * \brief Creates Time from time passed since day start. Reverse of sinceDayStart().
+         * \param p_since_day_start std::chrono::nanoseconds. Part which is finer than precision is dropped.
+         * \param p_precision Precision.
+         * \param p_offset TimeZone.
+         * \return Result<Time> which holds either Time or ErrorCode::OUT_OF_RANGE if time is negative or is not less than 24 hours.
+         */
+        [[nodiscard]] static auto fromSinceDayStart(std::chrono::nanoseconds p_since_day_start,
+                                                    Precision p_precision,
+                                                    TimeZone p_offset = TimeZone::UTC) noexcept -> Result< Time >;
+
         /**
          * \brief Sets formatter for class aka for all instances.
+         * \note Thread safe: may be called while other threads format values, which see either previous or new formatter.
+         * Empty formatter restores default representation. See GlobalFormatter.
          * \param p_formatter std::function<std::string(const Time&)>
          */
         static void setGlobalFormatter(Formatter&& p_formatter);
@@ -308,6 +370,12 @@ namespace tristan::time {
          */
         void setLocalFormatter(Formatter&& p_formatter);
 
+        /**
+         * \brief Returns true if neither local nor global formatter is set, that is if toString() returns canonical representation.
+         * \return bool.
+         */
+        [[nodiscard]] auto usesDefaultFormatter() const -> bool;
+
         /**
          * \brief Generates default string representation of time which is ISO standard representation in formats represented below.
          * \return std::string.
@@ -320,10 +388,31 @@ namespace tristan::time {
          */
         [[nodiscard]] auto toString() const -> std::string;
 
+        /**
+         * \brief Writes canonical representation to [p_first, p_last), that is time in the layout of toString() followed by [+HH] or [-HH] offset.
+         * Formatters are not used.
+         * \param p_first char*.
+         * \param p_last char*.
+         * \return std::to_chars_result with pointer past the last written character,
+         * or with p_last and std::errc::value_too_large if representation does not fit in which case the range is left untouched.
+         */
+        auto toChars(char* p_first, char* p_last) const noexcept -> std::to_chars_result;
+
+        /**
+         * \brief Appends canonical representation to p_string. See toChars.
+         * \param p_string std::string&.
+         */
+        void appendTo(std::string& p_string) const;
+
+        /**
+         * \brief Returns canonical representation stored inline, so no allocation takes place even for the longest representation. See toChars.
+         * \return FixedString<g_time_max_length>.
+         */
+        [[nodiscard]] auto toFixedString() const noexcept -> FixedString< tristan::time::g_time_max_length >;
 
     protected:
     private:
-        inline static Formatter m_formatter_global;
+        inline static GlobalFormatter< Formatter > m_formatter_global;
 
         Formatter m_formatter_local;
 
@@ -333,6 +422,14 @@ namespace tristan::time {
         TimeZone m_offset;
 
         Precision m_precision;
+
+        Time(std::chrono::nanoseconds p_time_since_day_start, Precision p_precision, tristan::TimeZone p_offset) noexcept;
+
+        /**
+         * \brief Assigns value, that is time, precision and offset, of p_other, local formatter is kept.
+         */
+        void _assignValue(const Time& p_other) noexcept;
+
         void _addMinutes(uint64_t minutes);
         void _addSeconds(uint64_t seconds);
         void _addMilliseconds(uint64_t milliseconds);
@@ -393,9 +490,21 @@ namespace tristan::time {
      * \param out std::ostream&
      * \param time const Time&
      * \return std::ostream&
-     * \note Method toString() is used here
+     * \note Canonical representation is formatted on the stack and inserted without allocation, width and fill flags of the stream are applied.
+     * If formatter is set, result of toString() is inserted instead.
      */
     auto operator<<(std::ostream& out, const Time& time) -> std::ostream&;
+    /**
+     * \brief Operator >>
+     * Reads characters which may belong to Time string representation (see Time(std::string_view)) directly from the stream buffer, without intermediate strings,
+     * and parses them. Leading whitespace is skipped if std::ios_base::skipws is set, the same way as numeric extractors do.
+     * \param in std::istream&
+     * \param time Time&. Value is assigned only if parsing succeeds, local formatter is kept.
+     * \return std::istream&
+     * Reading stops at the first character which can not continue valid representation, e.g. [2024-01-01-2024-02-01] holds two dates.
+     * \note std::ios_base::failbit is set if representation is malformed, std::ios_base::eofbit is set if end of stream is reached.
+     */
+    auto operator>>(std::istream& in, Time& time) -> std::istream&;
 }  //namespace tristan::time
 
 #endif  // TIME_HPP
@@ -0,0 +1,167 @@
+#ifndef TIMESTAMP_RENDERER_HPP
+#define TIMESTAMP_RENDERER_HPP
+
+#include "formatter.hpp"
+#include "spsc_ring.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace tristan::date_time {
+
+    /**
+     * \brief Raw clock value captured on latency critical path. Capturing is one clock read, conversion to DateTime is deferred.
+     * \headerfile timestamp_renderer.hpp
+     */
+    struct CapturedTime {
+        /// Nanoseconds passed since 1970-01-01T00:00:00 UTC.
+        int64_t epoch_nanoseconds;
+
+        /**
+         * \brief Captures current time.
+         * \return CapturedTime.
+         */
+        [[nodiscard]] static auto now() noexcept -> CapturedTime {
+            return CapturedTime{std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::system_clock::now().time_since_epoch()).count()};
+        }
+
+        /**
+         * \brief Converts captured value. See DateTime::fromSinceEpoch.
+         * \param p_precision time::Precision.
+         * \param p_offset TimeZone.
+         * \return Result<DateTime>.
+         */
+        [[nodiscard]] auto toDateTime(time::Precision p_precision = time::Precision::NANOSECONDS, TimeZone p_offset = TimeZone::UTC) const noexcept
+            -> Result< DateTime > {
+            return DateTime::fromSinceEpoch(std::chrono::nanoseconds(epoch_nanoseconds), p_precision, p_offset);
+        }
+    };
+
+    /**
+     * \brief Batch of rendered timestamps passed to the sink of TimestampRenderer. Views are valid only during the sink call.
+     */
+    struct RenderedBatch {
+        /// Tags passed to TimestampRenderer::submit, one per row.
+        std::span< const uint64_t > tags;
+        /// Number of rows plus one offsets of rows in text, see formatBatch.
+        std::span< const uint32_t > offsets;
+        /// Text of all rows.
+        std::string_view text;
+
+        /**
+         * \brief Returns number of rows.
+         * \return size_t.
+         */
+        [[nodiscard]] auto size() const -> size_t { return tags.size(); }
+
+        /**
+         * \brief Returns text of the row.
+         * \param p_row size_t.
+         * \return std::string_view.
+         */
+        [[nodiscard]] auto operator[](size_t p_row) const -> std::string_view {
+            return text.substr(offsets[p_row], offsets[p_row + 1] - offsets[p_row]);
+        }
+    };
+
+    /**
+     * \brief Renders captured timestamps to text on a background thread, so that latency critical threads only capture clock values.
+     * Producer thread hands CapturedTime with a caller defined tag (e.g. record sequence number) over lock-free single producer,
+     * single consumer ring. Background thread takes up to max_batch_size values at once, formats them with FormatSpec
+     * and passes the batch to the sink.
+     * \note submit() and capture() do not call formatting code and do not allocate. They have to be called from one thread at a time,
+     * use one renderer per producer thread.
+     * \par Example:
+     * \code
+     * tristan::date_time::TimestampRenderer renderer([&](const RenderedBatch& p_batch) { writeRecords(p_batch); },
+     *                                                tristan::date_time::FormatSpec(".6"));
+     * renderer.capture(record_id);
+     * \endcode
+     * \headerfile timestamp_renderer.hpp
+     */
+    class TimestampRenderer {
+    public:
+        /**
+         * \brief Number of values which may wait for rendering.
+         */
+        static constexpr size_t ring_capacity = 4096;
+
+        /**
+         * \brief Maximum number of rows passed to the sink at once.
+         */
+        static constexpr size_t max_batch_size = 256;
+
+        /**
+         * \brief Receives rendered batches on the background thread. Exceptions thrown by the sink terminate the program.
+         */
+        using Sink = std::function< void(const RenderedBatch&) >;
+
+        /**
+         * \brief Starts background thread.
+         * \param p_sink Sink.
+         * \param p_spec FormatSpec. Values are converted with NANOSECONDS precision, so canonical representation has 9 fraction digits
+         * unless specification sets precision or pattern.
+         * \param p_offset TimeZone. Offset of rendered values.
+         * \throws std::invalid_argument - if sink is empty.
+         */
+        explicit TimestampRenderer(Sink p_sink, FormatSpec p_spec = FormatSpec(), TimeZone p_offset = TimeZone::UTC);
+
+        TimestampRenderer(const TimestampRenderer&) = delete;
+        TimestampRenderer(TimestampRenderer&&) = delete;
+
+        /**
+         * \brief Renders all submitted values and stops background thread. See stop().
+         */
+        ~TimestampRenderer();
+
+        auto operator=(const TimestampRenderer&) -> TimestampRenderer& = delete;
+        auto operator=(TimestampRenderer&&) -> TimestampRenderer& = delete;
+
+        /**
+         * \brief Hands captured value over to background thread.
+         * \param p_time CapturedTime.
+         * \param p_tag uint64_t. Passed to the sink together with the rendered text.
+         * \return bool. False if ring is full, in which case value is dropped.
+         */
+        auto submit(CapturedTime p_time, uint64_t p_tag = 0) noexcept -> bool { return m_ring.tryPush(Record{p_time, p_tag}); }
+
+        /**
+         * \brief Captures current time and submits it. See submit.
+         * \param p_tag uint64_t.
+         * \return bool.
+         */
+        auto capture(uint64_t p_tag = 0) noexcept -> bool { return submit(CapturedTime::now(), p_tag); }
+
+        /**
+         * \brief Renders values which were submitted before the call and stops background thread. Values submitted afterwards are not rendered.
+         */
+        void stop();
+
+    protected:
+    private:
+        struct Record {
+            CapturedTime time;
+            uint64_t tag;
+        };
+
+        SpscRing< Record, ring_capacity > m_ring;
+        Sink m_sink;
+        FormatSpec m_spec;
+        TimeZone m_offset;
+        std::atomic< bool > m_stopping;
+
+        // Consumer side buffers, allocated once.
+        std::array< Record, max_batch_size > m_records;
+        std::vector< uint64_t > m_tags;
+        std::vector< uint32_t > m_offsets;
+        std::vector< char > m_text;
+
+        std::thread m_worker;
+
+        void _run();
+        void _render(size_t p_count);
+    };
+
+}  // namespace tristan::date_time
+
+#endif  // TIMESTAMP_RENDERER_HPP
@@ -0,0 +1,351 @@
+#include "batch.hpp"
+#include "detail/digits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+    using tristan::detail::g_nanoseconds_in_day;
+    using tristan::detail::g_nanoseconds_in_hour;
+    using tristan::detail::writeTwoDigits;
+
+    template < typename T >
+    void checkColumnSize(std::span< T > p_column, size_t p_size, const char* p_name, const char* p_function = "tristan::date_time::parseBatch") {
+        if (not p_column.empty() && p_column.size() < p_size) {
+            throw std::invalid_argument(std::string(p_function) + ": Column " + p_name + " is too small");
+        }
+    }
+
+    void checkColumns(const tristan::date_time::BatchColumns& p_columns, size_t p_rows) {
+        checkColumnSize(p_columns.epoch_nanoseconds, p_rows, "epoch_nanoseconds");
+        checkColumnSize(p_columns.days_since_epoch, p_rows, "days_since_epoch");
+        checkColumnSize(p_columns.nanoseconds_since_day_start, p_rows, "nanoseconds_since_day_start");
+        checkColumnSize(p_columns.offsets, p_rows, "offsets");
+        checkColumnSize(p_columns.validity, (p_rows + 7) / 8, "validity");
+    }
+
+    /**
+     * \brief Parses rows one by one and scatters the result into the columns. Row is returned by p_row(index).
+     */
+    template < typename RowGetter >
+    auto parseRows(size_t p_rows, RowGetter&& p_row, const tristan::date_time::BatchColumns& p_columns, tristan::date_time::ParserBackend p_backend)
+        -> size_t {
+        if (not p_columns.validity.empty()) {
+            std::fill_n(p_columns.validity.begin(), (p_rows + 7) / 8, 0);
+        }
+        size_t l_valid = 0;
+        for (size_t l_index = 0; l_index < p_rows; ++l_index) {
+            int64_t l_days = 0;
+            int64_t l_time = 0;
+            int8_t l_offset = 0;
+            int64_t l_epoch = 0;
+            if (auto l_result = tristan::date_time::DateTime::tryParse(p_row(l_index), p_backend); l_result) {
+                l_days = l_result->date().daysSinceEpoch();
+                l_time = l_result->time().sinceDayStart().count();
+                l_offset = static_cast< int8_t >(l_result->time().offset());
+                l_epoch = l_days * g_nanoseconds_in_day + l_time - l_offset * g_nanoseconds_in_hour;
+                if (not p_columns.validity.empty()) {
+                    p_columns.validity[l_index / 8] |= static_cast< uint8_t >(1U << (l_index % 8));
+                }
+                ++l_valid;
+            }
+            if (not p_columns.epoch_nanoseconds.empty()) {
+                p_columns.epoch_nanoseconds[l_index] = l_epoch;
+            }
+            if (not p_columns.days_since_epoch.empty()) {
+                p_columns.days_since_epoch[l_index] = static_cast< int32_t >(l_days);
+            }
+            if (not p_columns.nanoseconds_since_day_start.empty()) {
+                p_columns.nanoseconds_since_day_start[l_index] = l_time;
+            }
+            if (not p_columns.offsets.empty()) {
+                p_columns.offsets[l_index] = l_offset;
+            }
+        }
+        return l_valid;
+    }
+
+    inline constexpr int64_t g_first_day = tristan::date::daysFromCivil(1, 1, 1900);
+    inline constexpr int64_t g_last_day = tristan::date::daysFromCivil(31, 12, tristan::date::g_max_year);
+
+    inline constexpr auto g_three_digits = [] {
+        std::array< char, 3000 > l_table{};
+        for (size_t l_index = 0; l_index < 1000; ++l_index) {
+            l_table[l_index * 3] = static_cast< char >('0' + l_index / 100);
+            l_table[l_index * 3 + 1] = static_cast< char >('0' + l_index / 10 % 10);
+            l_table[l_index * 3 + 2] = static_cast< char >('0' + l_index % 10);
+        }
+        return l_table;
+    }();
+
+    /**
+     * \brief Converts four values less than 100 packed into 16 bit lanes into eight ASCII digits, two per lane with the tens first.
+     * Lane products do not exceed 16 bits, so one multiplication divides all lanes by 10.
+     */
+    constexpr auto fourPairs(uint64_t p_lanes) -> uint64_t {
+        const uint64_t l_tens = ((p_lanes * 103) >> 10) & 0x000F000F000F000F;
+        const uint64_t l_ones = p_lanes - l_tens * 10;
+        return l_tens | (l_ones << 8) | 0x3030303030303030;
+    }
+
+    constexpr auto packLanes(uint32_t p_first, uint32_t p_second, uint32_t p_third, uint32_t p_fourth) -> uint64_t {
+        return p_first | (static_cast< uint64_t >(p_second) << 16) | (static_cast< uint64_t >(p_third) << 32) | (static_cast< uint64_t >(p_fourth) << 48);
+    }
+
+    static_assert(fourPairs(packLanes(20, 24, 1, 99)) == 0x3939313034323032);
+
+    /**
+     * \brief Value of a row split into fields of the canonical layout.
+     */
+    struct RowFields {
+        int64_t days_since_epoch;
+        uint64_t since_day_start;
+        int8_t offset;
+    };
+
+    /**
+     * \brief Writes [YYYY-MM-DD].
+     */
+    auto writeDate(char* p_buffer, int64_t p_days_since_epoch) -> char* {
+        const auto l_civil = tristan::date::civilFromDays(p_days_since_epoch);
+        if constexpr (std::endian::native == std::endian::little) {
+            const uint64_t l_digits = fourPairs(packLanes(l_civil.year / 100, l_civil.year % 100, l_civil.month, l_civil.day));
+            // YYYY-MM- in one store, DD in the second one.
+            const uint64_t l_head = (l_digits & 0xFFFFFFFF) | (uint64_t{'-'} << 32) | (((l_digits >> 32) & 0xFFFF) << 40) | (uint64_t{'-'} << 56);
+            const auto l_tail = static_cast< uint16_t >(l_digits >> 48);
+            std::memcpy(p_buffer, &l_head, sizeof(l_head));
+            std::memcpy(p_buffer + sizeof(l_head), &l_tail, sizeof(l_tail));
+        } else {
+            writeTwoDigits(p_buffer, l_civil.year / 100);
+            writeTwoDigits(p_buffer + 2, l_civil.year % 100);
+            p_buffer[4] = '-';
+            writeTwoDigits(p_buffer + 5, l_civil.month);
+            p_buffer[7] = '-';
+            writeTwoDigits(p_buffer + 8, l_civil.day);
+        }
+        return p_buffer + tristan::date::g_date_max_length;
+    }
+
+    /**
+     * \brief Writes [HH:MM[:SS[.mmm[.mmm[.nnn]]]]+(-)HH].
+     */
+    auto writeTime(char* p_buffer, uint64_t p_since_day_start, int8_t p_offset, tristan::time::Precision p_precision) -> char* {
+        const auto l_seconds = static_cast< uint32_t >(p_since_day_start / 1000000000);
+        const auto l_fraction = static_cast< uint32_t >(p_since_day_start % 1000000000);
+        const auto l_offset = static_cast< uint32_t >(p_offset < 0 ? -p_offset : p_offset);
+        std::array< char, 2 > l_offset_digits{};
+        char* l_end = p_buffer;
+        if constexpr (std::endian::native == std::endian::little) {
+            const uint64_t l_digits = fourPairs(packLanes(l_seconds / 3600, l_seconds / 60 % 60, l_seconds % 60, l_offset));
+            // HH:MM:SS in one store. Row is at least 8 characters long, so for MINUTES precision the store does not leave the row.
+            const uint64_t l_head = (l_digits & 0xFFFF) | (uint64_t{':'} << 16) | (((l_digits >> 16) & 0xFFFF) << 24) | (uint64_t{':'} << 40)
+                                  | (((l_digits >> 32) & 0xFFFF) << 48);
+            std::memcpy(l_end, &l_head, sizeof(l_head));
+            std::memcpy(l_offset_digits.data(), reinterpret_cast< const char* >(&l_digits) + 6, 2);
+        } else {
+            const std::array< uint32_t, 3 > l_pairs{l_seconds / 3600, l_seconds / 60 % 60, l_seconds % 60};
+            for (size_t l_pair = 0; l_pair < l_pairs.size(); ++l_pair) {
+                std::memcpy(l_end + l_pair * 3, g_three_digits.data() + l_pairs[l_pair] * 3 + 1, 2);
+            }
+            l_end[2] = ':';
+            l_end[5] = ':';
+            std::memcpy(l_offset_digits.data(), g_three_digits.data() + l_offset * 3 + 1, 2);
+        }
+        l_end += p_precision >= tristan::time::Precision::SECONDS ? 8 : 5;
+        const std::array< uint32_t, 3 > l_groups{l_fraction / 1000000, l_fraction / 1000 % 1000, l_fraction % 1000};
+        for (size_t l_group = 1; l_group < static_cast< size_t >(p_precision); ++l_group) {
+            l_end[0] = '.';
+            std::memcpy(l_end + 1, g_three_digits.data() + l_groups[l_group - 1] * 3, 3);
+            l_end += 4;
+        }
+        l_end[0] = p_offset < 0 ? '-' : '+';
+        std::memcpy(l_end + 1, l_offset_digits.data(), 2);
+        return l_end + 3;
+    }
+
+    /**
+     * \brief Writes rows one after another. Row is returned by p_row(index).
+     */
+    template < typename RowGetter >
+    auto formatRows(size_t p_rows,
+                    RowGetter&& p_row,
+                    tristan::date_time::BatchFormat p_format,
+                    tristan::time::Precision p_precision,
+                    std::span< char > p_buffer,
+                    std::string_view p_separator,
+                    std::span< uint32_t > p_offsets) -> size_t {
+        if (p_buffer.size() < tristan::date_time::batchBufferSize(p_rows, p_format, p_precision, p_separator)) {
+            throw std::invalid_argument("tristan::date_time::formatBatch: Buffer is too small");
+        }
+        checkColumnSize(p_offsets, p_rows + 1, "offsets", "tristan::date_time::formatBatch");
+        char* l_begin = p_buffer.data();
+        char* l_end = l_begin;
+        for (size_t l_index = 0; l_index < p_rows; ++l_index) {
+            if (l_index != 0) {
+                l_end = std::copy(p_separator.begin(), p_separator.end(), l_end);
+            }
+            if (not p_offsets.empty()) {
+                p_offsets[l_index] = static_cast< uint32_t >(l_end - l_begin);
+            }
+            const RowFields l_fields = p_row(l_index);
+            if (p_format != tristan::date_time::BatchFormat::TIME) {
+                l_end = writeDate(l_end, l_fields.days_since_epoch);
+            }
+            if (p_format == tristan::date_time::BatchFormat::DATE_TIME) {
+                *l_end++ = 'T';
+            }
+            if (p_format != tristan::date_time::BatchFormat::DATE) {
+                l_end = writeTime(l_end, l_fields.since_day_start, l_fields.offset, p_precision);
+            }
+        }
+        if (not p_offsets.empty()) {
+            p_offsets[p_rows] = static_cast< uint32_t >(l_end - l_begin);
+        }
+        return static_cast< size_t >(l_end - l_begin);
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::parseBatch(std::span< const std::string_view > p_rows,
+                                    const tristan::date_time::BatchColumns& p_columns,
+                                    tristan::date_time::ParserBackend p_backend) -> size_t {
+    checkColumns(p_columns, p_rows.size());
+    return parseRows(
+        p_rows.size(),
+        [p_rows](size_t p_index) {
+            return p_rows[p_index];
+        },
+        p_columns,
+        p_backend);
+}
+
+auto tristan::date_time::parseBatch(std::string_view p_buffer,
+                                    std::span< const uint32_t > p_offsets,
+                                    const tristan::date_time::BatchColumns& p_columns,
+                                    tristan::date_time::ParserBackend p_backend) -> size_t {
+    if (p_offsets.empty()) {
+        return 0;
+    }
+    if (not std::is_sorted(p_offsets.begin(), p_offsets.end()) || p_offsets.back() > p_buffer.size()) {
+        throw std::invalid_argument("tristan::date_time::parseBatch: Offsets are out of buffer");
+    }
+    auto l_rows = p_offsets.size() - 1;
+    checkColumns(p_columns, l_rows);
+    return parseRows(
+        l_rows,
+        [p_buffer, p_offsets](size_t p_index) {
+            return p_buffer.substr(p_offsets[p_index], p_offsets[p_index + 1] - p_offsets[p_index]);
+        },
+        p_columns,
+        p_backend);
+}
+
+void tristan::date_time::isoWeekBatch(std::span< const int32_t > p_days_since_epoch, std::span< uint16_t > p_week_years, std::span< uint8_t > p_weeks) {
+    checkColumnSize(p_week_years, p_days_since_epoch.size(), "week_years", "tristan::date_time::isoWeekBatch");
+    checkColumnSize(p_weeks, p_days_since_epoch.size(), "weeks", "tristan::date_time::isoWeekBatch");
+    for (size_t l_row = 0; l_row < p_days_since_epoch.size(); ++l_row) {
+        const auto l_iso_week_date = tristan::date::isoWeekDateFromDaysSinceEpoch(p_days_since_epoch[l_row]);
+        if (not p_week_years.empty()) {
+            p_week_years[l_row] = l_iso_week_date.year;
+        }
+        if (not p_weeks.empty()) {
+            p_weeks[l_row] = l_iso_week_date.week;
+        }
+    }
+}
+
+void tristan::date_time::dayOfTheYearBatch(std::span< const int32_t > p_days_since_epoch, std::span< uint16_t > p_days_of_the_year) {
+    if (p_days_of_the_year.size() < p_days_since_epoch.size()) {
+        throw std::invalid_argument("tristan::date_time::dayOfTheYearBatch: Column days_of_the_year is too small");
+    }
+    std::transform(p_days_since_epoch.begin(), p_days_since_epoch.end(), p_days_of_the_year.begin(), [](int32_t p_days) {
+        return tristan::date::dayOfTheYearFromDaysSinceEpoch(p_days);
+    });
+}
+
+auto tristan::date_time::formatBatch(std::span< const tristan::date_time::DateTime > p_values,
+                                     tristan::time::Precision p_precision,
+                                     std::span< char > p_buffer,
+                                     std::string_view p_separator,
+                                     std::span< uint32_t > p_offsets) -> size_t {
+    return formatRows(
+        p_values.size(),
+        [p_values](size_t p_index) {
+            const auto& l_time = p_values[p_index].time();
+            return RowFields{p_values[p_index].date().daysSinceEpoch(),
+                             static_cast< uint64_t >(l_time.sinceDayStart().count()),
+                             static_cast< int8_t >(l_time.offset())};
+        },
+        tristan::date_time::BatchFormat::DATE_TIME,
+        p_precision,
+        p_buffer,
+        p_separator,
+        p_offsets);
+}
+
+auto tristan::date_time::formatBatch(std::span< const tristan::date::Date > p_values,
+                                     std::span< char > p_buffer,
+                                     std::string_view p_separator,
+                                     std::span< uint32_t > p_offsets) -> size_t {
+    return formatRows(
+        p_values.size(),
+        [p_values](size_t p_index) {
+            return RowFields{p_values[p_index].daysSinceEpoch(), 0, 0};
+        },
+        tristan::date_time::BatchFormat::DATE,
+        tristan::time::Precision::MINUTES,
+        p_buffer,
+        p_separator,
+        p_offsets);
+}
+
+auto tristan::date_time::formatBatch(std::span< const tristan::time::Time > p_values,
+                                     tristan::time::Precision p_precision,
+                                     std::span< char > p_buffer,
+                                     std::string_view p_separator,
+                                     std::span< uint32_t > p_offsets) -> size_t {
+    return formatRows(
+        p_values.size(),
+        [p_values](size_t p_index) {
+            return RowFields{0, static_cast< uint64_t >(p_values[p_index].sinceDayStart().count()), static_cast< int8_t >(p_values[p_index].offset())};
+        },
+        tristan::date_time::BatchFormat::TIME,
+        p_precision,
+        p_buffer,
+        p_separator,
+        p_offsets);
+}
+
+auto tristan::date_time::formatBatch(std::span< const int64_t > p_epoch_nanoseconds,
+                                     tristan::time::Precision p_precision,
+                                     std::span< char > p_buffer,
+                                     std::string_view p_separator,
+                                     std::span< uint32_t > p_offsets,
+                                     tristan::TimeZone p_offset) -> size_t {
+    const auto l_offset = static_cast< int8_t >(p_offset);
+    return formatRows(
+        p_epoch_nanoseconds.size(),
+        [p_epoch_nanoseconds, l_offset](size_t p_index) {
+            const int64_t l_shift = l_offset * g_nanoseconds_in_hour;
+            const int64_t l_value = p_epoch_nanoseconds[p_index];
+            // Values near the limits of int64_t are far out of range of Date, so they are rejected before the shift may overflow.
+            if ((l_shift > 0 && l_value > std::numeric_limits< int64_t >::max() - l_shift)
+                || (l_shift < 0 && l_value < std::numeric_limits< int64_t >::min() - l_shift)) {
+                throw std::range_error("tristan::date_time::formatBatch: Value is out of range");
+            }
+            const int64_t l_local = l_value + l_shift;
+            const int64_t l_days = l_local >= 0 ? l_local / g_nanoseconds_in_day : (l_local + 1) / g_nanoseconds_in_day - 1;
+            if (l_days < g_first_day || l_days > g_last_day) {
+                throw std::range_error("tristan::date_time::formatBatch: Value is out of range");
+            }
+            return RowFields{l_days, static_cast< uint64_t >(l_local - l_days * g_nanoseconds_in_day), l_offset};
+        },
+        tristan::date_time::BatchFormat::DATE_TIME,
+        p_precision,
+        p_buffer,
+        p_separator,
+        p_offsets);
+}
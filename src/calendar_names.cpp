@@ -0,0 +1,73 @@
+#include "calendar_names.hpp"
+
+#include <array>
+#include <stdexcept>
+
+namespace {
+
+    inline constexpr auto g_day_names = tristan::date_time::calendarNames(tristan::date_time::Locale::ENGLISH).weekday_abbreviations;
+    inline constexpr auto g_month_names = tristan::date_time::calendarNames(tristan::date_time::Locale::ENGLISH).month_abbreviations;
+
+    /**
+     * \brief Slot of perfect hash table of three letter names. Value is index of the name plus one, 0 marks empty slot.
+     */
+    struct NameSlot {
+        uint32_t key;
+        uint8_t value;
+    };
+
+    constexpr auto nameKey(const char* p_name) -> uint32_t {
+        return static_cast< uint32_t >(static_cast< uint8_t >(p_name[0])) | static_cast< uint32_t >(static_cast< uint8_t >(p_name[1])) << 8
+             | static_cast< uint32_t >(static_cast< uint8_t >(p_name[2])) << 16;
+    }
+
+    /**
+     * \brief Multiplicative hash. Multipliers below were selected so that names of days and months do not collide.
+     */
+    template < uint32_t Multiplier, uint8_t Bits > constexpr auto nameHash(uint32_t p_key) -> uint32_t {
+        return static_cast< uint32_t >(p_key * Multiplier) >> (32 - Bits);
+    }
+
+    inline constexpr uint32_t g_day_hash_multiplier = 0x6a8ac4bb;
+    inline constexpr uint8_t g_day_hash_bits = 3;
+    inline constexpr uint32_t g_month_hash_multiplier = 0x0741c7a9;
+    inline constexpr uint8_t g_month_hash_bits = 4;
+
+    template < uint32_t Multiplier, uint8_t Bits, size_t Size > constexpr auto makeNameTable(const std::array< std::string_view, Size >& p_names) {
+        std::array< NameSlot, size_t{1} << Bits > l_table{};
+        for (size_t l_index = 0; l_index < Size; ++l_index) {
+            auto l_key = nameKey(p_names[l_index].data());
+            auto& l_slot = l_table[nameHash< Multiplier, Bits >(l_key)];
+            if (l_slot.value != 0) {
+                throw std::logic_error("Names collide");
+            }
+            l_slot = NameSlot{l_key, static_cast< uint8_t >(l_index + 1)};
+        }
+        return l_table;
+    }
+
+    inline constexpr auto g_day_table = makeNameTable< g_day_hash_multiplier, g_day_hash_bits >(g_day_names);
+    inline constexpr auto g_month_table = makeNameTable< g_month_hash_multiplier, g_month_hash_bits >(g_month_names);
+
+    /**
+     * \brief Looks name up in perfect hash table.
+     * \return Index of the name plus one or 0 if name is unknown.
+     */
+    template < uint32_t Multiplier, uint8_t Bits, typename Table > auto lookupName(const Table& p_table, const char* p_name) -> uint8_t {
+        auto l_key = nameKey(p_name);
+        const auto& l_slot = p_table[nameHash< Multiplier, Bits >(l_key)];
+        return l_slot.key == l_key ? l_slot.value : 0;
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::monthAbbreviation(uint8_t p_month) -> std::string_view { return g_month_names.at(p_month - 1); }
+
+auto tristan::date_time::weekdayAbbreviation(uint8_t p_day_of_the_week) -> std::string_view { return g_day_names.at(p_day_of_the_week); }
+
+auto tristan::date_time::monthFromAbbreviation(const char* p_name) noexcept -> uint8_t {
+    return lookupName< g_month_hash_multiplier, g_month_hash_bits >(g_month_table, p_name);
+}
+
+auto tristan::date_time::weekdayFromAbbreviation(const char* p_name) noexcept -> int8_t {
+    return static_cast< int8_t >(lookupName< g_day_hash_multiplier, g_day_hash_bits >(g_day_table, p_name) - 1);
+}
@@ -1,26 +1,22 @@
 #include "date.hpp"
+#include "detail/digits.hpp"
+#include "detail/extract.hpp"
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 namespace {
 
     inline constexpr uint16_t g_non_leap_year_days{365};
     inline constexpr uint16_t g_leap_year_days{366};
     inline constexpr uint16_t g_days_since_1900_to_1970{25567};
-    inline constexpr uint16_t g_start_year = 1900;
-
-    using Years = std::chrono::duration< int64_t, std::ratio_divide< std::ratio< 31536000 >, std::chrono::seconds::period > >;
-
-    inline constexpr uint8_t g_february_start_day = 32;
-    inline constexpr std::pair< uint8_t, uint8_t > g_march_start_day = {60, 61};
-    inline constexpr std::pair< uint8_t, uint8_t > g_april_start_day = {91, 92};
-    inline constexpr std::pair< uint8_t, uint8_t > g_may_start_day = {121, 122};
-    inline constexpr std::pair< uint8_t, uint8_t > g_june_start_day = {152, 153};
-    inline constexpr std::pair< uint8_t, uint8_t > g_july_start_day = {182, 183};
-    inline constexpr std::pair< uint8_t, uint8_t > g_august_start_day = {213, 214};
-    inline constexpr std::pair< uint8_t, uint8_t > g_september_start_day = {244, 245};
-    inline constexpr std::pair< uint16_t, uint16_t > g_october_start_day = {274, 275};
-    inline constexpr std::pair< uint16_t, uint16_t > g_november_start_day = {305, 306};
-    inline constexpr std::pair< uint16_t, uint16_t > g_december_start_day = {335, 336};
+    inline constexpr uint16_t g_start_year = tristan::date::g_min_year;
+    inline constexpr uint16_t g_end_year = tristan::date::g_max_year;
 
     enum Months : uint8_t {
         JANUARY = 1,
@@ -37,22 +33,137 @@ namespace {
         DECEMBER
     };
 
+    using tristan::detail::fromDigits;
+    using tristan::detail::writeTwoDigits;
+
+    using tristan::date::daysFromCivil;
+
+    using tristan::date::civilFromDays;
+
+    static_assert(daysFromCivil(1, 1, 1970) == 0);
+    static_assert(daysFromCivil(1, 1, 1900) == -static_cast< int64_t >(g_days_since_1900_to_1970));
+    static_assert(daysFromCivil(1, 3, 2100) == 47541);
+    static_assert(civilFromDays(-1).year == 1969 && civilFromDays(-1).month == DECEMBER && civilFromDays(-1).day == 31);
+    static_assert(civilFromDays(47541).year == 2100 && civilFromDays(47541).month == MARCH && civilFromDays(47541).day == 1);
+
+    inline constexpr int64_t g_last_day_since_epoch = daysFromCivil(31, DECEMBER, g_end_year);
+
+    /**
+     * \brief Returns ISO day of the week in range 1 (Monday) - 7 (Sunday). 1970-01-01 was Thursday.
+     */
+    constexpr auto isoDayOfTheWeek(int64_t p_days_since_epoch) -> uint8_t {
+        return static_cast< uint8_t >((p_days_since_epoch % 7 + 10) % 7 + 1);
+    }
+
+    static_assert(isoDayOfTheWeek(0) == 4 && isoDayOfTheWeek(-3) == 1 && isoDayOfTheWeek(-4) == 7);
+
+    /**
+     * \brief Returns true if p_text matches p_layout, where 'd' stands for decimal digit and any other character for itself.
+     */
+    constexpr auto matchesLayout(std::string_view p_text, std::string_view p_layout) -> bool {
+        if (p_text.size() != p_layout.size()) {
+            return false;
+        }
+        for (size_t l_pos = 0; l_pos < p_text.size(); ++l_pos) {
+            if (p_layout[l_pos] == 'd' ? p_text[l_pos] < '0' || p_text[l_pos] > '9' : p_text[l_pos] != p_layout[l_pos]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void appendDigits(std::string& p_string, uint16_t p_value, uint8_t p_width) {
+        char l_digits[4];
+        for (uint8_t l_index = p_width; l_index > 0; --l_index) {
+            l_digits[l_index - 1] = static_cast< char >('0' + p_value % 10);
+            p_value /= 10;
+        }
+        p_string.append(l_digits, p_width);
+    }
+
     auto g_default_global_formatter = [](const tristan::date::Date& p_date) -> std::string {
         std::string result;
-        result += std::to_string(p_date.year());
-        result += '-';
-        uint8_t month = p_date.month();
-        if (month < 10)
-            result += '0';
-        result += std::to_string(month);
-        result += '-';
-        uint8_t day = p_date.dayOfTheMonth();
-        if (day < 10)
-            result += '0';
-        result += std::to_string(day);
-
+        p_date.appendTo(result);
         return result;
     };
+
+    /**
+     * \brief Writes [YYYY-MM-DD]. Buffer has to hold g_date_max_length characters.
+     */
+    void writeDate(char* p_buffer, int64_t p_days_since_epoch) {
+        const auto l_civil = civilFromDays(p_days_since_epoch);
+        writeTwoDigits(p_buffer, l_civil.year / 100);
+        writeTwoDigits(p_buffer + 2, l_civil.year % 100);
+        p_buffer[4] = '-';
+        writeTwoDigits(p_buffer + 5, l_civil.month);
+        p_buffer[7] = '-';
+        writeTwoDigits(p_buffer + 8, l_civil.day);
+    }
+
+    // Text table is indexed by days since 1900 as stored in Date, so that lookup does not need any conversion.
+    inline constexpr int64_t g_text_table_block_days = 512;
+    inline constexpr int64_t g_text_table_days = daysFromCivil(1, 1, 2156) + g_days_since_1900_to_1970 + 1;
+    inline constexpr size_t g_text_table_blocks = static_cast< size_t >((g_text_table_days + g_text_table_block_days - 1) / g_text_table_block_days);
+    inline constexpr size_t g_text_table_block_size = static_cast< size_t >(g_text_table_block_days) * tristan::date::g_date_max_length;
+
+    std::atomic< bool > g_text_table_enabled{false};
+
+    /**
+     * \brief Lazily filled blocks of canonical representations. Block is published once and never changes afterwards.
+     * \note Blocks are leaked on purpose, so that dates may be formatted from static destructors and threads which outlive main().
+     */
+    struct TextTable {
+        std::array< std::atomic< char* >, g_text_table_blocks > blocks{};
+
+        TextTable() = default;
+        TextTable(const TextTable&) = delete;
+        TextTable(TextTable&&) = delete;
+
+        ~TextTable() = default;
+
+        auto operator=(const TextTable&) -> TextTable& = delete;
+        auto operator=(TextTable&&) -> TextTable& = delete;
+
+        /**
+         * \brief Returns representation of the day or nullptr if day is out of the table or block could not be allocated.
+         */
+        auto find(int64_t p_days_since_1900) -> const char* {
+            if (p_days_since_1900 < 0 || p_days_since_1900 >= g_text_table_days) {
+                return nullptr;
+            }
+            const auto l_block_index = static_cast< size_t >(p_days_since_1900 / g_text_table_block_days);
+            const char* l_block = blocks[l_block_index].load(std::memory_order_acquire);
+            if (l_block == nullptr) {
+                l_block = _fill(l_block_index);
+                if (l_block == nullptr) {
+                    return nullptr;
+                }
+            }
+            return l_block + static_cast< size_t >(p_days_since_1900 % g_text_table_block_days) * tristan::date::g_date_max_length;
+        }
+
+    private:
+        auto _fill(size_t p_block_index) -> const char* {
+            // Formatting is noexcept, so failed allocation falls back to computation.
+            std::unique_ptr< char[] > l_block(new (std::nothrow) char[g_text_table_block_size]);
+            if (not l_block) {
+                return nullptr;
+            }
+            const auto l_first_day = static_cast< int64_t >(p_block_index) * g_text_table_block_days - g_days_since_1900_to_1970 - 1;
+            for (int64_t l_day = 0; l_day < g_text_table_block_days; ++l_day) {
+                writeDate(l_block.get() + l_day * static_cast< int64_t >(tristan::date::g_date_max_length), l_first_day + l_day);
+            }
+            char* l_expected = nullptr;
+            // Threads may fill the same block concurrently, the first published block is used by everyone.
+            if (blocks[p_block_index].compare_exchange_strong(l_expected, l_block.get(), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return l_block.release();
+            }
+            return l_expected;
+        }
+    };
+
+    TextTable g_text_table;
+    static_assert(std::is_trivially_destructible_v< TextTable >);
 }  //End of unnamed namespace
 
 tristan::date::Date::Date() :
@@ -73,8 +184,8 @@ tristan::date::Date::Date(tristan::TimeZone p_time_zone) :
 }
 
 tristan::date::Date::Date(uint8_t p_day, uint8_t p_month, uint16_t p_year) {
-    if (p_year < g_start_year) {
-        std::string message = "tristan::date::Date(int year, int month, int day): bad [year] value was provided - " + std::to_string(p_day)
+    if (p_year < g_start_year || p_year > g_end_year) {
+        std::string message = "tristan::date::Date(int year, int month, int day): bad [year] value was provided - " + std::to_string(p_year)
                               + " the value between 1900 and 2155 is expected";
         throw std::range_error(message);
     }
@@ -99,67 +210,14 @@ tristan::date::Date::Date(uint8_t p_day, uint8_t p_month, uint16_t p_year) {
             throw std::range_error(message);
         }
     }
-    m_days_since_1900 = std::chrono::duration_cast< Days >(Years{p_year - g_start_year});
-    m_days_since_1900 += Days{static_cast< uint8_t >(_calculateCurrentYear() * 365 / (g_non_leap_year_days * 4))};
-    for (int l_month = 1; l_month < p_month; ++l_month) {
-        if (l_month == 1 || l_month == 3 || l_month == 5 || l_month == 7 || l_month == 8 || l_month == 10 || l_month == 12) {
-            m_days_since_1900 += Days{31};
-        } else if (l_month == 4 || l_month == 6 || l_month == 9 || l_month == 11) {
-            m_days_since_1900 += Days{30};
-        } else {
-            bool leap_year = isLeapYear(std::chrono::duration_cast< Years >(m_days_since_1900).count() + g_start_year);
-            if (!leap_year) {
-                m_days_since_1900 += Days{28};
-            } else {
-                m_days_since_1900 += Days{29};
-            }
-        }
-    }
-    m_days_since_1900 += Days{p_day};
+    _setDate(p_day, p_month, p_year);
 }
 
-tristan::date::Date::Date(const std::string& p_iso_date) {
-    auto l_length = p_iso_date.length();
-    if (l_length != 8 && l_length != 10) {
-        throw std::invalid_argument("Provided date has invalid format. "
-                                    "Value should be provided as either 8 (YYYYMMDD) or 10 (YYYY-MM-DD) characters string. "
-                                    "But "
-                                    + std::to_string(l_length) + " characters string was provided");
-    }
-    if (!(std::find_if(p_iso_date.begin(),
-                       p_iso_date.end(),
-                       [](const char c) {
-                           if (c < '0' || c > '9') {
-                               if (c != '-') {
-                                   return true;
-                               }
-                           }
-                           return false;
-                       })
-          != p_iso_date.end())) {
-        uint16_t l_year = static_cast< uint16_t >(std::stoi(p_iso_date.substr(0, 4)));
-        uint8_t l_month;
-        uint8_t l_day;
-
-        switch (l_length) {//NOLINT
-            case 8: {
-                l_month = std::stoi(p_iso_date.substr(4, 2));
-                l_day = std::stoi(p_iso_date.substr(6, 2));
-                break;
-            }
-            case 10: {
-                l_month = std::stoi(p_iso_date.substr(5, 2));
-                l_day = std::stoi(p_iso_date.substr(8, 2));
-                break;
-            }
-        }
-        *this = tristan::date::Date(l_day, l_month, l_year);
-    } else {
-        std::string message = "tristan::date::Date::Date(const std::string &iso_date): Bad [iso_date] string "
-                              "format. String should contain only numbers and hyphen";
-        throw std::invalid_argument(message);
-    }
-}
+tristan::date::Date::Date(Days p_days_since_1900) noexcept :
+    m_days_since_1900(p_days_since_1900) { }
+
+tristan::date::Date::Date(std::string_view p_iso_date) :
+    tristan::date::Date(tryParse(p_iso_date).valueOrThrow("tristan::date::Date::Date(std::string_view p_iso_date)")) { }
 
 auto tristan::date::Date::operator==(const tristan::date::Date& other) const -> bool { return m_days_since_1900 == other.m_days_since_1900; }
 
@@ -345,6 +403,8 @@ auto tristan::date::Date::year() const -> uint16_t { return _calculateCurrentYea
 
 auto tristan::date::Date::isWeekend() const -> bool { return this->dayOfTheWeek() > 5; }
 
+auto tristan::date::Date::daysSinceEpoch() const -> int64_t { return m_days_since_1900.count() - g_days_since_1900_to_1970 - 1; }
+
 bool tristan::date::Date::isLeapYear(uint16_t p_year) {
     if (p_year % 4 == 0) {
         if (p_year % 100 == 0) {
@@ -361,89 +421,118 @@ bool tristan::date::Date::isLeapYear(uint16_t p_year) {
     }
 }
 
-void tristan::date::Date::setGlobalFormatter(tristan::date::Formatter&& p_formatter) { m_formatter_global = std::move(p_formatter); }
+void tristan::date::Date::setGlobalFormatter(tristan::date::Formatter&& p_formatter) { m_formatter_global.set(std::move(p_formatter)); }
 
 void tristan::date::Date::setLocalFormatter(tristan::date::Formatter&& p_formatter) { m_formatter_local = std::move(p_formatter); }
 
+auto tristan::date::Date::usesDefaultFormatter() const -> bool {
+    return not m_formatter_local && not m_formatter_global.installed();
+}
+
 std::string tristan::date::Date::toString() const {
-    if (not m_formatter_global) {
-        tristan::date::Date::m_formatter_global = g_default_global_formatter;
-    }
     if (m_formatter_local) {
         return m_formatter_local(*this);
     }
-    return m_formatter_global(*this);
+    if (const auto l_formatter = m_formatter_global.get(); l_formatter) {
+        return (*l_formatter)(*this);
+    }
+    return g_default_global_formatter(*this);
+}
+
+auto tristan::date::Date::toChars(char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    if (p_last - p_first < static_cast< std::ptrdiff_t >(tristan::date::g_date_max_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    const char* l_text = g_text_table_enabled.load(std::memory_order_relaxed) ? g_text_table.find(m_days_since_1900.count()) : nullptr;
+    if (l_text != nullptr) {
+        std::memcpy(p_first, l_text, tristan::date::g_date_max_length);
+    } else {
+        writeDate(p_first, daysSinceEpoch());
+    }
+    return {p_first + tristan::date::g_date_max_length, std::errc{}};
+}
+
+void tristan::date::Date::appendTo(std::string& p_string) const {
+    std::array< char, tristan::date::g_date_max_length > l_buffer;
+    const auto l_result = toChars(l_buffer.data(), l_buffer.data() + l_buffer.size());
+    p_string.append(l_buffer.data(), l_result.ptr);
+}
+
+auto tristan::date::Date::toFixedString() const noexcept -> tristan::FixedString< tristan::date::g_date_max_length > {
+    tristan::FixedString< tristan::date::g_date_max_length > l_string;
+    const auto l_result = toChars(l_string.data(), l_string.data() + l_string.capacity());
+    l_string.resize(static_cast< size_t >(l_result.ptr - l_string.data()));
+    return l_string;
 }
 
+void tristan::date::Date::setTextTableEnabled(bool p_enabled) { g_text_table_enabled.store(p_enabled, std::memory_order_relaxed); }
+
+auto tristan::date::Date::isTextTableEnabled() -> bool { return g_text_table_enabled.load(std::memory_order_relaxed); }
+
 auto tristan::date::Date::localDate() -> tristan::date::Date {
     auto tm = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
     auto offset = std::localtime(&tm)->tm_gmtoff;
     return tristan::date::Date(static_cast< tristan::TimeZone >(offset / 3600));
 }
 
-auto tristan::date::Date::_calculateCurrentMonth() const -> uint8_t {
-    uint16_t days_since_year_start = _calculateDaysInYear();
-    bool leap_year = tristan::date::Date::isLeapYear(_calculateCurrentYear() + g_start_year);
-    if ((!leap_year && days_since_year_start >= g_december_start_day.first) || (leap_year && days_since_year_start >= g_december_start_day.second)) {
-        return Months::DECEMBER;
-    } else if ((!leap_year && days_since_year_start >= g_november_start_day.first) || (leap_year && days_since_year_start >= g_november_start_day.second)) {
-        return Months::NOVEMBER;
-    } else if ((!leap_year && days_since_year_start >= g_october_start_day.first) || (leap_year && days_since_year_start >= g_october_start_day.second)) {
-        return Months::OCTOBER;
-    } else if ((!leap_year && days_since_year_start >= g_september_start_day.first) || (leap_year && days_since_year_start >= g_september_start_day.second)) {
-        return Months::SEPTEMBER;
-    } else if ((!leap_year && days_since_year_start >= g_august_start_day.first) || (leap_year && days_since_year_start >= g_august_start_day.second)) {
-        return Months::AUGUST;
-    } else if ((!leap_year && days_since_year_start >= g_july_start_day.first) || (leap_year && days_since_year_start >= g_july_start_day.second)) {
-        return Months::JULY;
-    } else if ((!leap_year && days_since_year_start >= g_june_start_day.first) || (leap_year && days_since_year_start >= g_june_start_day.second)) {
-        return Months::JUNE;
-    } else if ((!leap_year && days_since_year_start >= g_may_start_day.first) || (leap_year && days_since_year_start >= g_may_start_day.second)) {
-        return Months::MAY;
-    } else if ((!leap_year && days_since_year_start >= g_april_start_day.first) || (leap_year && days_since_year_start >= g_april_start_day.second)) {
-        return Months::APRIL;
-    } else if ((!leap_year && days_since_year_start >= g_march_start_day.first) || (leap_year && days_since_year_start >= g_march_start_day.second)) {
-        return Months::MARCH;
-    } else if (days_since_year_start >= g_february_start_day) {
-        return Months::FEBRUARY;
-    } else {
-        return Months::JANUARY;
+auto tristan::date::Date::tryParse(std::string_view p_iso_date) noexcept -> tristan::Result< tristan::date::Date > {
+    auto l_length = p_iso_date.length();
+    if (l_length != 8 && l_length != 10) {
+        return tristan::ErrorCode::INVALID_FORMAT;
     }
-}
-
-auto tristan::date::Date::_calculateCurrentYear() const -> uint8_t {
-    auto number_of_leap_days = static_cast< uint8_t >(m_days_since_1900.count() / (g_non_leap_year_days * 4));
+    const bool l_extended = l_length == 10;
+    for (size_t l_pos = 0; l_pos < l_length; ++l_pos) {
+        const bool l_hyphen_expected = l_extended && (l_pos == 4 || l_pos == 7);
+        if ((l_hyphen_expected && p_iso_date[l_pos] != '-') || (!l_hyphen_expected && (p_iso_date[l_pos] < '0' || p_iso_date[l_pos] > '9'))) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+    }
+    auto l_year = fromDigits< uint16_t >(p_iso_date.data(), 4);
+    auto l_month = fromDigits< uint8_t >(p_iso_date.data() + (l_extended ? 5 : 4), 2);
+    auto l_day = fromDigits< uint8_t >(p_iso_date.data() + (l_extended ? 8 : 6), 2);
 
-    return (m_days_since_1900.count() - number_of_leap_days) / g_non_leap_year_days;
+    return tristan::date::Date::tryCreate(l_day, l_month, l_year);
 }
 
-auto tristan::date::Date::_calculateDayOfTheMonth() const -> uint8_t {
+auto tristan::date::Date::tryCreate(uint8_t p_day, uint8_t p_month, uint16_t p_year) noexcept -> tristan::Result< tristan::date::Date > {
+    if (p_year < g_start_year || p_year > g_end_year || p_day < 1 || p_month < 1 || p_month > 12) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    uint8_t l_days_in_month = 31;
+    if (p_month == 4 || p_month == 6 || p_month == 9 || p_month == 11) {
+        l_days_in_month = 30;
+    } else if (p_month == 2) {
+        l_days_in_month = tristan::date::Date::isLeapYear(p_year) ? 29 : 28;
+    }
+    if (p_day > l_days_in_month) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    tristan::date::Date l_date(Days{0});
+    l_date._setDate(p_day, p_month, p_year);
+    return l_date;
+}
 
-    uint16_t days_in_month = _calculateDaysInYear();
-    for (int month = _calculateCurrentMonth() - 1; month >= Months::JANUARY; --month) {
-        if (month == 1 || month == 3 || month == 5 || month == 7 || month == 8 || month == 10 || month == 12) {
-            days_in_month -= 31;
-        } else if (month == 4 || month == 6 || month == 9 || month == 11) {
-            days_in_month -= 30;
-        } else {
-            bool leap_year = isLeapYear(_calculateCurrentYear() + g_start_year);
-            if (!leap_year) {
-                days_in_month -= 28;
-            } else {
-                days_in_month -= 29;
-            }
-        }
+auto tristan::date::Date::fromDaysSinceEpoch(int64_t p_days_since_epoch) noexcept -> tristan::Result< tristan::date::Date > {
+    if (p_days_since_epoch < -static_cast< int64_t >(g_days_since_1900_to_1970) || p_days_since_epoch > g_last_day_since_epoch) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
     }
-    return days_in_month;
+    return tristan::date::Date(Days{p_days_since_epoch + g_days_since_1900_to_1970 + 1});
 }
 
+void tristan::date::Date::_setDate(uint8_t p_day, uint8_t p_month, uint16_t p_year) noexcept {
+    m_days_since_1900 = Days{daysFromCivil(p_day, p_month, p_year) + g_days_since_1900_to_1970 + 1};
+}
+
+void tristan::date::Date::_assignValue(const tristan::date::Date& p_other) noexcept { m_days_since_1900 = p_other.m_days_since_1900; }
+
+auto tristan::date::Date::_calculateCurrentMonth() const -> uint8_t { return civilFromDays(daysSinceEpoch()).month; }
+
+auto tristan::date::Date::_calculateCurrentYear() const -> uint8_t { return static_cast< uint8_t >(civilFromDays(daysSinceEpoch()).year - g_start_year); }
+
+auto tristan::date::Date::_calculateDayOfTheMonth() const -> uint8_t { return civilFromDays(daysSinceEpoch()).day; }
+
 auto tristan::date::Date::_calculateDaysInYear() const -> uint16_t {
-    auto number_of_leap_days = static_cast< uint8_t >(m_days_since_1900.count() / (g_non_leap_year_days * 4));
-    if (tristan::date::Date::isLeapYear(_calculateCurrentYear() + g_start_year)) {
-        number_of_leap_days -= 1;
-    }
-    uint8_t years = _calculateCurrentYear();
-    return static_cast< uint16_t >(m_days_since_1900.count() - years * g_non_leap_year_days - number_of_leap_days);
+    return tristan::date::dayOfTheYearFromDaysSinceEpoch(daysSinceEpoch());
 }
 
 bool tristan::date::operator!=(const tristan::date::Date& l, const tristan::date::Date& r) { return !(l == r); }
@@ -455,6 +544,107 @@ bool tristan::date::operator<=(const tristan::date::Date& l, const tristan::date
 bool tristan::date::operator>=(const tristan::date::Date& l, const tristan::date::Date& r) { return l > r || l == r; }
 
 std::ostream& tristan::date::operator<<(std::ostream& out, const tristan::date::Date& date) {
-    out << date.toString();
+    if (not date.usesDefaultFormatter()) {
+        out << date.toString();
+        return out;
+    }
+    const auto l_text = date.toFixedString();
+    out << l_text.view();
     return out;
 }
+
+auto tristan::date::isoWeekDateFromDaysSinceEpoch(int64_t p_days_since_epoch) noexcept -> tristan::date::IsoWeekDate {
+    const auto l_day = isoDayOfTheWeek(p_days_since_epoch);
+    // ISO week belongs to the year of its Thursday.
+    const auto l_thursday = p_days_since_epoch - l_day + 4;
+    const auto l_year = civilFromDays(l_thursday).year;
+    return tristan::date::IsoWeekDate{l_year, static_cast< uint8_t >((l_thursday - daysFromCivil(1, JANUARY, l_year)) / 7 + 1), l_day};
+}
+
+auto tristan::date::dayOfTheYearFromDaysSinceEpoch(int64_t p_days_since_epoch) noexcept -> uint16_t {
+    return static_cast< uint16_t >(p_days_since_epoch - daysFromCivil(1, JANUARY, civilFromDays(p_days_since_epoch).year) + 1);
+}
+
+auto tristan::date::Date::dayOfTheYear() const -> uint16_t { return _calculateDaysInYear(); }
+
+auto tristan::date::Date::isoWeekDate() const -> tristan::date::IsoWeekDate { return isoWeekDateFromDaysSinceEpoch(daysSinceEpoch()); }
+
+auto tristan::date::Date::isoWeek() const -> uint8_t { return isoWeekDate().week; }
+
+auto tristan::date::Date::isoWeekYear() const -> uint16_t { return isoWeekDate().year; }
+
+auto tristan::date::Date::toIsoWeekString() const -> std::string {
+    const auto l_iso_week_date = isoWeekDate();
+    std::string l_result;
+    l_result.reserve(10);
+    appendDigits(l_result, l_iso_week_date.year, 4);
+    l_result += "-W";
+    appendDigits(l_result, l_iso_week_date.week, 2);
+    l_result += '-';
+    appendDigits(l_result, l_iso_week_date.day, 1);
+    return l_result;
+}
+
+auto tristan::date::Date::toOrdinalString() const -> std::string {
+    std::string l_result;
+    l_result.reserve(8);
+    appendDigits(l_result, year(), 4);
+    l_result += '-';
+    appendDigits(l_result, dayOfTheYear(), 3);
+    return l_result;
+}
+
+auto tristan::date::Date::fromIsoWeekDate(const tristan::date::IsoWeekDate& p_iso_week_date) noexcept -> tristan::Result< tristan::date::Date > {
+    // Last days of December may belong to the first week of the next year, the exact bound is checked by fromDaysSinceEpoch.
+    if (p_iso_week_date.year < g_start_year || p_iso_week_date.year > g_end_year + 1 || p_iso_week_date.week < 1 || p_iso_week_date.day < 1
+        || p_iso_week_date.day > 7) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    // December 28th always falls into the last week of the year.
+    if (p_iso_week_date.week > isoWeekDateFromDaysSinceEpoch(daysFromCivil(28, DECEMBER, p_iso_week_date.year)).week) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    // January 4th always falls into the first week of the year.
+    const auto l_january_4 = daysFromCivil(4, JANUARY, p_iso_week_date.year);
+    const auto l_first_monday = l_january_4 - isoDayOfTheWeek(l_january_4) + 1;
+    return fromDaysSinceEpoch(l_first_monday + (p_iso_week_date.week - 1) * 7 + p_iso_week_date.day - 1);
+}
+
+auto tristan::date::Date::fromOrdinal(uint16_t p_year, uint16_t p_day_of_the_year) noexcept -> tristan::Result< tristan::date::Date > {
+    if (p_year < g_start_year || p_year > g_end_year || p_day_of_the_year < 1
+        || p_day_of_the_year > (isLeapYear(p_year) ? g_leap_year_days : g_non_leap_year_days)) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    return fromDaysSinceEpoch(daysFromCivil(1, JANUARY, p_year) + p_day_of_the_year - 1);
+}
+
+auto tristan::date::Date::tryParseIsoWeek(std::string_view p_iso_week_date) noexcept -> tristan::Result< tristan::date::Date > {
+    const bool l_extended = matchesLayout(p_iso_week_date, "dddd-Wdd-d");
+    if (not l_extended && not matchesLayout(p_iso_week_date, "ddddWddd")) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    return fromIsoWeekDate(tristan::date::IsoWeekDate{fromDigits< uint16_t >(p_iso_week_date.data(), 4),
+                                                      fromDigits< uint8_t >(p_iso_week_date.data() + (l_extended ? 6 : 5), 2),
+                                                      fromDigits< uint8_t >(p_iso_week_date.data() + (l_extended ? 9 : 7), 1)});
+}
+
+auto tristan::date::Date::tryParseOrdinal(std::string_view p_ordinal_date) noexcept -> tristan::Result< tristan::date::Date > {
+    const bool l_extended = matchesLayout(p_ordinal_date, "dddd-ddd");
+    if (not l_extended && not matchesLayout(p_ordinal_date, "ddddddd")) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    return fromOrdinal(fromDigits< uint16_t >(p_ordinal_date.data(), 4), fromDigits< uint16_t >(p_ordinal_date.data() + (l_extended ? 5 : 4), 3));
+}
+
+auto tristan::date::operator>>(std::istream& in, tristan::date::Date& date) -> std::istream& {
+    tristan::detail::LayoutMatcher l_matcher(tristan::detail::g_date_table);
+    return tristan::detail::extract< tristan::date::g_date_max_length >(
+        in, [&l_matcher](char p_char) { return l_matcher.extend(p_char); }, [&date](std::string_view p_text) {
+            auto l_result = tristan::date::Date::tryParse(p_text);
+            if (not l_result) {
+                return false;
+            }
+            date._assignValue(*l_result);
+            return true;
+        });
+}
@@ -1,4 +1,15 @@
 #include "date_time.hpp"
+#include "detail/extract.hpp"
+
+#include <array>
+
+#if defined(__SSSE3__) || defined(__AVX__)
+  #define TRISTAN_DATE_TIME_SIMD 1
+  #include <cstring>
+  #include <immintrin.h>
+#else
+  #define TRISTAN_DATE_TIME_SIMD 0
+#endif
 
 namespace {
 
@@ -15,6 +26,197 @@ namespace {
     [[maybe_unused]] constexpr uint8_t g_minutes_in_hour = 60;
     constexpr uint8_t g_hours_in_day = 24;
 
+
+#if TRISTAN_DATE_TIME_SIMD
+    /**
+     * \brief Date and time fields decoded by SIMD parser.
+     */
+    struct IsoFields {
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+        uint8_t hours;
+        uint8_t minutes;
+        uint8_t seconds;
+        uint16_t milliseconds;
+        uint16_t microseconds;
+        uint16_t nanoseconds;
+        int8_t offset;
+        tristan::time::Precision precision;
+    };
+
+    inline constexpr size_t g_simd_buffer_size = 48;
+    inline constexpr size_t g_simd_chunk_size = 16;
+    inline constexpr size_t g_simd_chunks = g_simd_buffer_size / g_simd_chunk_size;
+    inline constexpr uint8_t g_simd_zero_lane = 0x80;
+    inline constexpr std::array< uint8_t, 5 > g_simd_time_lengths{5, 8, 12, 16, 20};
+
+    /**
+     * \brief Per layout tables for SIMD parser.
+     * expected - separator which is expected at the position or 0 for positions which are not in use.
+     * digits - 0xFF at positions where digit is expected.
+     * main_shuffle - gathers [YYYYMMDDhhmmss] digits into one register.
+     * fraction_shuffle - gathers [0mmm0uuu0nnn00HH] digits into one register.
+     */
+    struct SimdLayout {
+        alignas(16) std::array< uint8_t, g_simd_buffer_size > expected;
+        alignas(16) std::array< uint8_t, g_simd_buffer_size > digits;
+        alignas(16) std::array< uint8_t, g_simd_buffer_size > main_shuffle;
+        alignas(16) std::array< uint8_t, g_simd_buffer_size > fraction_shuffle;
+    };
+
+    constexpr auto makeSimdLayout(bool p_extended_date, size_t p_time_length, bool p_offset) -> SimdLayout {
+        SimdLayout l_layout{};
+        for (size_t l_pos = 0; l_pos < g_simd_buffer_size; ++l_pos) {
+            l_layout.main_shuffle[l_pos] = g_simd_zero_lane;
+            l_layout.fraction_shuffle[l_pos] = g_simd_zero_lane;
+        }
+        std::string_view l_date_template = p_extended_date ? "dddd-dd-dd" : "dddddddd";
+        std::string_view l_time_template = "dd:dd:dd.ddd.ddd.ddd";
+        size_t l_pos = 0;
+        auto l_put = [&l_layout, &l_pos](char p_char) {
+            if (p_char == 'd') {
+                l_layout.digits[l_pos] = 0xFF;
+            } else {
+                l_layout.expected[l_pos] = static_cast< uint8_t >(p_char);
+            }
+            ++l_pos;
+        };
+        for (auto l_char: l_date_template) {
+            l_put(l_char);
+        }
+        l_put('T');
+        for (size_t l_index = 0; l_index < p_time_length; ++l_index) {
+            l_put(l_time_template[l_index]);
+        }
+        if (p_offset) {
+            ++l_pos;  // Sign is checked before SIMD validation and is zeroed in the buffer
+            l_put('d');
+            l_put('d');
+        }
+        // Lanes of the packed register are filled from chunk which holds the source byte. Shuffle index is relative to the chunk.
+        auto l_route = [](std::array< uint8_t, g_simd_buffer_size >& p_shuffle, size_t p_lane, size_t p_source) {
+            p_shuffle[(p_source / g_simd_chunk_size) * g_simd_chunk_size + p_lane] = static_cast< uint8_t >(p_source % g_simd_chunk_size);
+        };
+        auto l_route_field = [&l_route](std::array< uint8_t, g_simd_buffer_size >& p_shuffle, size_t p_lane, size_t p_source, size_t p_width) {
+            for (size_t l_index = 0; l_index < p_width; ++l_index) {
+                l_route(p_shuffle, p_lane + l_index, p_source + l_index);
+            }
+        };
+        const size_t l_time_pos = l_date_template.size() + 1;
+        l_route_field(l_layout.main_shuffle, 0, 0, 4);
+        l_route_field(l_layout.main_shuffle, 4, p_extended_date ? 5 : 4, 2);
+        l_route_field(l_layout.main_shuffle, 6, p_extended_date ? 8 : 6, 2);
+        l_route_field(l_layout.main_shuffle, 8, l_time_pos, 2);
+        l_route_field(l_layout.main_shuffle, 10, l_time_pos + 3, 2);
+        if (p_time_length >= 8) {
+            l_route_field(l_layout.main_shuffle, 12, l_time_pos + 6, 2);
+        }
+        if (p_time_length >= 12) {
+            l_route_field(l_layout.fraction_shuffle, 1, l_time_pos + 9, 3);
+        }
+        if (p_time_length >= 16) {
+            l_route_field(l_layout.fraction_shuffle, 5, l_time_pos + 13, 3);
+        }
+        if (p_time_length >= 20) {
+            l_route_field(l_layout.fraction_shuffle, 9, l_time_pos + 17, 3);
+        }
+        if (p_offset) {
+            l_route_field(l_layout.fraction_shuffle, 14, l_time_pos + p_time_length + 1, 2);
+        }
+        return l_layout;
+    }
+
+    /**
+     * \brief Layouts are indexed by [extended date][time length index][offset presence].
+     */
+    inline constexpr auto g_simd_layouts = []() {
+        std::array< SimdLayout, 2 * g_simd_time_lengths.size() * 2 > l_layouts{};
+        size_t l_index = 0;
+        for (bool l_extended: {false, true}) {
+            for (auto l_time_length: g_simd_time_lengths) {
+                for (bool l_offset: {false, true}) {
+                    l_layouts[l_index++] = makeSimdLayout(l_extended, l_time_length, l_offset);
+                }
+            }
+        }
+        return l_layouts;
+    }();
+
+    /**
+     * \brief Validates and decodes the whole record with SSSE3 instructions.
+     * Record is copied into zero padded buffer and processed as three 16 bytes chunks. Every chunk is validated against layout template
+     * (digit or exact separator at every position) and digits are gathered with pshufb into two registers which are converted with pmaddubsw/pmaddwd.
+     * \return false if record does not match any supported layout. Range of values is not checked here.
+     */
+    auto parseIsoSimd(std::string_view p_date_time, IsoFields& p_fields) -> bool {
+        const size_t l_length = p_date_time.size();
+        if (l_length < 14 || l_length > 34) {
+            return false;
+        }
+        const bool l_extended = p_date_time[4] == '-';
+        const bool l_offset = p_date_time[l_length - 3] == '+' || p_date_time[l_length - 3] == '-';
+        const size_t l_time_length = l_length - (l_extended ? 11 : 9) - (l_offset ? 3 : 0);
+        size_t l_time_index = 0;
+        while (l_time_index < g_simd_time_lengths.size() && g_simd_time_lengths[l_time_index] != l_time_length) {
+            ++l_time_index;
+        }
+        if (l_time_index == g_simd_time_lengths.size()) {
+            return false;
+        }
+        const auto& l_layout = g_simd_layouts[(l_extended ? g_simd_time_lengths.size() * 2 : 0) + l_time_index * 2 + (l_offset ? 1 : 0)];
+
+        alignas(16) char l_buffer[g_simd_buffer_size]{};
+        std::memcpy(l_buffer, p_date_time.data(), l_length);
+        if (l_offset) {
+            l_buffer[l_length - 3] = 0;
+        }
+
+        const __m128i l_zero_char = _mm_set1_epi8('0');
+        const __m128i l_nine = _mm_set1_epi8(9);
+        __m128i l_main = _mm_setzero_si128();
+        __m128i l_fraction = _mm_setzero_si128();
+        int l_valid = 0xFFFF;
+        for (size_t l_chunk = 0; l_chunk < g_simd_chunks; ++l_chunk) {
+            const size_t l_offset_in_buffer = l_chunk * g_simd_chunk_size;
+            const __m128i l_chars = _mm_load_si128(reinterpret_cast< const __m128i* >(l_buffer + l_offset_in_buffer));
+            const __m128i l_values = _mm_sub_epi8(l_chars, l_zero_char);
+            const __m128i l_is_digit = _mm_cmpeq_epi8(_mm_min_epu8(l_values, l_nine), l_values);
+            const __m128i l_digit_mask = _mm_load_si128(reinterpret_cast< const __m128i* >(l_layout.digits.data() + l_offset_in_buffer));
+            const __m128i l_is_expected
+                = _mm_cmpeq_epi8(l_chars, _mm_load_si128(reinterpret_cast< const __m128i* >(l_layout.expected.data() + l_offset_in_buffer)));
+            l_valid &= _mm_movemask_epi8(_mm_or_si128(_mm_and_si128(l_is_digit, l_digit_mask), _mm_andnot_si128(l_digit_mask, l_is_expected)));
+            l_main = _mm_or_si128(
+                l_main, _mm_shuffle_epi8(l_values, _mm_load_si128(reinterpret_cast< const __m128i* >(l_layout.main_shuffle.data() + l_offset_in_buffer))));
+            l_fraction = _mm_or_si128(
+                l_fraction,
+                _mm_shuffle_epi8(l_values, _mm_load_si128(reinterpret_cast< const __m128i* >(l_layout.fraction_shuffle.data() + l_offset_in_buffer))));
+        }
+        if (l_valid != 0xFFFF) {
+            return false;
+        }
+        const __m128i l_tens = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1);
+        alignas(16) uint16_t l_pairs[8];
+        _mm_store_si128(reinterpret_cast< __m128i* >(l_pairs), _mm_maddubs_epi16(l_main, l_tens));
+        alignas(16) int32_t l_quads[4];
+        _mm_store_si128(reinterpret_cast< __m128i* >(l_quads),
+                        _mm_madd_epi16(_mm_maddubs_epi16(l_fraction, l_tens), _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1)));
+
+        p_fields.year = static_cast< uint16_t >(l_pairs[0] * 100 + l_pairs[1]);
+        p_fields.month = static_cast< uint8_t >(l_pairs[2]);
+        p_fields.day = static_cast< uint8_t >(l_pairs[3]);
+        p_fields.hours = static_cast< uint8_t >(l_pairs[4]);
+        p_fields.minutes = static_cast< uint8_t >(l_pairs[5]);
+        p_fields.seconds = static_cast< uint8_t >(l_pairs[6]);
+        p_fields.milliseconds = static_cast< uint16_t >(l_quads[0]);
+        p_fields.microseconds = static_cast< uint16_t >(l_quads[1]);
+        p_fields.nanoseconds = static_cast< uint16_t >(l_quads[2]);
+        p_fields.offset = static_cast< int8_t >(l_offset && p_date_time[l_length - 3] == '-' ? -l_quads[3] : l_quads[3]);
+        p_fields.precision = static_cast< tristan::time::Precision >(l_time_index);
+        return true;
+    }
+#endif
+
 }  //End of anonymous namespace
 
 tristan::date_time::DateTime::DateTime(tristan::time::Precision p_precision) :
@@ -25,14 +227,12 @@ tristan::date_time::DateTime::DateTime(tristan::TimeZone p_time_zone, tristan::t
     m_date(p_time_zone),
     m_time(p_time_zone, p_precision) { }
 
-tristan::date_time::DateTime::DateTime(const std::string& p_date_time) {
-    auto delimiter_pos = p_date_time.find('T');
-    if (delimiter_pos == std::string::npos) {
-        throw std::runtime_error("tristan::date_time::DateTime::DateTime(const std::string& time): Invalid time format");
-    }
-    m_date = tristan::date::Date(p_date_time.substr(0, delimiter_pos));
-    m_time = tristan::time::Time(p_date_time.substr(delimiter_pos + 1));
-}
+tristan::date_time::DateTime::DateTime(std::string_view p_date_time) :
+    tristan::date_time::DateTime(parse(p_date_time)) { }
+
+tristan::date_time::DateTime::DateTime(tristan::date::Date&& p_date, tristan::time::Time&& p_time) :
+    m_date(std::move(p_date)),
+    m_time(std::move(p_time)) { }
 
 void tristan::date_time::DateTime::setDate(const tristan::date::Date& p_date) { m_date = p_date; }
 
@@ -42,6 +242,11 @@ void tristan::date_time::DateTime::setTime(const tristan::time::Time& p_time) {
 
 void tristan::date_time::DateTime::setTime(tristan::time::Time&& p_time) { m_time = std::move(p_time); }
 
+void tristan::date_time::DateTime::_assignValue(const tristan::date_time::DateTime& p_other) noexcept {
+    m_date._assignValue(p_other.m_date);
+    m_time._assignValue(p_other.m_time);
+}
+
 void tristan::date_time::DateTime::addSeconds([[maybe_unused]] uint64_t p_seconds) {
     uint64_t l_minutes = 0;
     if (p_seconds >= g_seconds_in_minute){
@@ -161,22 +366,57 @@ auto tristan::date_time::DateTime::date() const -> const tristan::date::Date& {
 
 auto tristan::date_time::DateTime::time() const -> const tristan::time::Time& { return m_time; }
 
+auto tristan::date_time::DateTime::sinceEpoch() const -> std::chrono::nanoseconds {
+    return tristan::date::Days{m_date.daysSinceEpoch()} + m_time.sinceDayStart() - std::chrono::hours{static_cast< int8_t >(m_time.offset())};
+}
+
 void tristan::date_time::DateTime::setTimeLocalFormatter(tristan::time::Formatter&& p_formatter) { m_time.setLocalFormatter(std::move(p_formatter)); }
 
 void tristan::date_time::DateTime::setDateLocalFormatter(tristan::date::Formatter&& p_formatter) { m_date.setLocalFormatter(std::move(p_formatter)); }
 
 void tristan::date_time::DateTime::setLocalFormatter(tristan::date_time::Formatter&& p_formatter) { m_formatter_local = std::move(p_formatter); }
 
-void tristan::date_time::DateTime::setGlobalFormatter(tristan::date_time::Formatter&& p_formatter) { m_formatter_global = std::move(p_formatter); }
+auto tristan::date_time::DateTime::usesDefaultFormatter() const -> bool {
+    return not m_formatter_local && not m_formatter_global.installed() && m_date.usesDefaultFormatter() && m_time.usesDefaultFormatter();
+}
+
+void tristan::date_time::DateTime::setGlobalFormatter(tristan::date_time::Formatter&& p_formatter) { m_formatter_global.set(std::move(p_formatter)); }
 
 auto tristan::date_time::DateTime::toString() const -> std::string {
-    if (not m_formatter_global) {
-        tristan::date_time::DateTime::m_formatter_global = g_default_global_formatter;
-    }
     if (m_formatter_local) {
         return m_formatter_local(*this);
     }
-    return m_formatter_global(*this);
+    if (const auto l_formatter = m_formatter_global.get(); l_formatter) {
+        return (*l_formatter)(*this);
+    }
+    return g_default_global_formatter(*this);
+}
+
+auto tristan::date_time::DateTime::toChars(char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    if (p_last - p_first <= static_cast< std::ptrdiff_t >(tristan::date::g_date_max_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    // Time part is written first as it is the only one which may not fit, so the range stays untouched on error.
+    auto l_result = m_time.toChars(p_first + tristan::date::g_date_max_length + 1, p_last);
+    if (l_result.ec != std::errc{}) {
+        return l_result;
+    }
+    m_date.toChars(p_first, p_first + tristan::date::g_date_max_length);
+    p_first[tristan::date::g_date_max_length] = 'T';
+    return l_result;
+}
+
+void tristan::date_time::DateTime::appendTo(std::string& p_string) const {
+    std::array< char, tristan::date_time::g_date_time_max_length > l_buffer;
+    const auto l_result = toChars(l_buffer.data(), l_buffer.data() + l_buffer.size());
+    p_string.append(l_buffer.data(), l_result.ptr);
+}
+
+auto tristan::date_time::DateTime::toFixedString() const noexcept -> tristan::FixedString< tristan::date_time::g_date_time_max_length > {
+    tristan::FixedString< tristan::date_time::g_date_time_max_length > l_string;
+    const auto l_result = toChars(l_string.data(), l_string.data() + l_string.capacity());
+    l_string.resize(static_cast< size_t >(l_result.ptr - l_string.data()));
+    return l_string;
 }
 
 auto tristan::date_time::DateTime::localDateTime() -> tristan::date_time::DateTime {
@@ -187,6 +427,80 @@ auto tristan::date_time::DateTime::localDateTime() -> tristan::date_time::DateTi
     return l_date_time;
 }
 
+auto tristan::date_time::DateTime::parse(std::string_view p_date_time, tristan::date_time::ParserBackend p_backend) -> tristan::date_time::DateTime {
+    return tryParse(p_date_time, p_backend).valueOrThrow("tristan::date_time::DateTime::parse(std::string_view p_date_time)");
+}
+
+auto tristan::date_time::DateTime::tryParse(std::string_view p_date_time, tristan::date_time::ParserBackend p_backend) noexcept
+    -> tristan::Result< tristan::date_time::DateTime > {
+#if TRISTAN_DATE_TIME_SIMD
+    IsoFields l_fields;
+    if (p_backend != tristan::date_time::ParserBackend::SCALAR && parseIsoSimd(p_date_time, l_fields)
+        && l_fields.offset >= static_cast< int8_t >(tristan::TimeZone::WEST_12) && l_fields.offset <= static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+        auto l_date = tristan::date::Date::tryCreate(l_fields.day, l_fields.month, l_fields.year);
+        if (not l_date) {
+            return l_date.error();
+        }
+        auto l_time = tristan::time::Time::tryCreate(l_fields.precision,
+                                                     l_fields.hours,
+                                                     l_fields.minutes,
+                                                     l_fields.seconds,
+                                                     l_fields.milliseconds,
+                                                     l_fields.microseconds,
+                                                     l_fields.nanoseconds);
+        if (not l_time) {
+            return l_time.error();
+        }
+        l_time->setOffset(static_cast< tristan::TimeZone >(l_fields.offset));
+        return tristan::date_time::DateTime(std::move(l_date).value(), std::move(l_time).value());
+    }
+#else
+    static_cast< void >(p_backend);
+#endif
+    auto l_delimiter_pos = p_date_time.find('T');
+    if (l_delimiter_pos == std::string_view::npos) {
+        return tristan::ErrorCode::MISSING_DELIMITER;
+    }
+    auto l_date = tristan::date::Date::tryParse(p_date_time.substr(0, l_delimiter_pos));
+    if (not l_date) {
+        return l_date.error();
+    }
+    auto l_time = tristan::time::Time::tryParse(p_date_time.substr(l_delimiter_pos + 1));
+    if (not l_time) {
+        return l_time.error();
+    }
+    return tristan::date_time::DateTime(std::move(l_date).value(), std::move(l_time).value());
+}
+
+auto tristan::date_time::DateTime::fromSinceEpoch(std::chrono::nanoseconds p_since_epoch,
+                                                  tristan::time::Precision p_precision,
+                                                  tristan::TimeZone p_offset) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    auto l_local = p_since_epoch + std::chrono::hours{static_cast< int8_t >(p_offset)};
+    auto l_days = std::chrono::floor< tristan::date::Days >(l_local);
+    auto l_date = tristan::date::Date::fromDaysSinceEpoch(l_days.count());
+    if (not l_date) {
+        return l_date.error();
+    }
+    auto l_time = tristan::time::Time::fromSinceDayStart(l_local - l_days, p_precision, p_offset);
+    if (not l_time) {
+        return l_time.error();
+    }
+    return tristan::date_time::DateTime(std::move(l_date).value(), std::move(l_time).value());
+}
+
+auto tristan::date_time::DateTime::fromLocal(tristan::date::Date&& p_date, tristan::time::Time&& p_time, std::chrono::minutes p_offset) noexcept
+    -> tristan::Result< tristan::date_time::DateTime > {
+    const auto l_offset_hours = std::chrono::duration_cast< std::chrono::hours >(p_offset);
+    if (l_offset_hours == p_offset && l_offset_hours.count() >= static_cast< int8_t >(tristan::TimeZone::WEST_12)
+        && l_offset_hours.count() <= static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+        p_time.setOffset(static_cast< tristan::TimeZone >(l_offset_hours.count()));
+        return tristan::date_time::DateTime(std::move(p_date), std::move(p_time));
+    }
+    return fromSinceEpoch(tristan::date::Days{p_date.daysSinceEpoch()} + p_time.sinceDayStart() - p_offset, p_time.precision());
+}
+
+auto tristan::date_time::DateTime::simdParserAvailable() -> bool { return TRISTAN_DATE_TIME_SIMD != 0; }
+
 auto tristan::date_time::DateTime::operator==(const tristan::date_time::DateTime& other) const -> bool {
     return m_date == other.m_date && m_time == other.m_time;
 }
@@ -204,7 +518,12 @@ auto tristan::date_time::DateTime::operator<(const tristan::date_time::DateTime&
 }
 
 auto tristan::date_time::operator<<(std::ostream& out, const tristan::date_time::DateTime& dt) -> std::ostream& {
-    out << dt.toString();
+    if (not dt.usesDefaultFormatter()) {
+        out << dt.toString();
+        return out;
+    }
+    const auto l_text = dt.toFixedString();
+    out << l_text.view();
     return out;
 }
 
@@ -215,3 +534,27 @@ auto tristan::date_time::operator>(const tristan::date_time::DateTime& l, const
 auto tristan::date_time::operator<=(const tristan::date_time::DateTime& l, const tristan::date_time::DateTime& r) -> bool { return (l < r || l == r); }
 
 auto tristan::date_time::operator>=(const tristan::date_time::DateTime& l, const tristan::date_time::DateTime& r) -> bool { return (l > r || l == r); }
+
+auto tristan::date_time::operator>>(std::istream& in, tristan::date_time::DateTime& dt) -> std::istream& {
+    tristan::detail::LayoutMatcher l_date_matcher(tristan::detail::g_date_table);
+    tristan::detail::LayoutMatcher l_time_matcher(tristan::detail::g_time_table);
+    bool l_time_started = false;
+    auto l_extend = [&](char p_char) {
+        if (l_time_started) {
+            return l_time_matcher.extend(p_char);
+        }
+        if (p_char == 'T' && l_date_matcher.complete()) {
+            l_time_started = true;
+            return true;
+        }
+        return l_date_matcher.extend(p_char);
+    };
+    return tristan::detail::extract< tristan::date_time::g_date_time_max_length >(in, l_extend, [&dt](std::string_view p_text) {
+        auto l_result = tristan::date_time::DateTime::tryParse(p_text);
+        if (not l_result) {
+            return false;
+        }
+        dt._assignValue(*l_result);
+        return true;
+    });
+}
@@ -0,0 +1,110 @@
+#include "date_time_now.hpp"
+#include "detail/digits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <limits>
+
+namespace {
+
+    using tristan::detail::g_nanoseconds_in_second;
+    using tristan::detail::writeThreeDigits;
+
+    // [YYYY-MM-DDTHH:MM:SS], of which [YYYY-MM-DDTHH:MM] is written for MINUTES precision.
+    inline constexpr size_t g_seconds_prefix_length = 19;
+    inline constexpr size_t g_minutes_prefix_length = 16;
+    // [+HH] which ends every representation.
+    inline constexpr size_t g_offset_length = 3;
+    inline constexpr int64_t g_seconds_in_hour = 3600;
+
+    /**
+     * \brief Part of the representation which changes at most once per second.
+     */
+    struct SecondCache {
+        int64_t second = std::numeric_limits< int64_t >::min();
+        std::array< char, g_seconds_prefix_length > prefix{};
+        std::array< char, g_offset_length > offset{};
+    };
+
+    thread_local SecondCache g_local_cache;
+    thread_local SecondCache g_utc_cache;
+
+    auto localOffset(int64_t p_second) -> int8_t {
+        const auto l_time = static_cast< std::time_t >(p_second);
+        std::tm l_tm{};
+        // std::localtime shares its result between threads, while the cache is refreshed by every thread on its own.
+        if (localtime_r(&l_time, &l_tm) == nullptr) {
+            return 0;
+        }
+        return static_cast< int8_t >(l_tm.tm_gmtoff / g_seconds_in_hour);
+    }
+
+    /**
+     * \brief Writes canonical representation of the second with DateTime::toChars and splits it into date and time prefix and offset.
+     * \return false if the second is out of range of Date, in which case cache is not changed.
+     */
+    auto renderSecond(int64_t p_second, int8_t p_offset, SecondCache& p_cache) -> bool {
+        const auto l_date_time = tristan::date_time::DateTime::fromSinceEpoch(
+            std::chrono::seconds(p_second), tristan::time::Precision::SECONDS, static_cast< tristan::TimeZone >(p_offset));
+        if (not l_date_time) {
+            return false;
+        }
+        std::array< char, g_seconds_prefix_length + g_offset_length > l_text{};
+        l_date_time->toChars(l_text.data(), l_text.data() + l_text.size());
+        std::copy_n(l_text.data(), g_seconds_prefix_length, p_cache.prefix.data());
+        std::copy_n(l_text.data() + g_seconds_prefix_length, g_offset_length, p_cache.offset.data());
+        p_cache.second = p_second;
+        return true;
+    }
+
+    auto writeNow(SecondCache& p_cache, bool p_local, char* p_first, char* p_last, tristan::time::Precision p_precision) noexcept
+        -> std::to_chars_result {
+        const auto l_groups = static_cast< size_t >(p_precision);
+        // Same layout as DateTime::toChars: [:SS] starting from seconds precision and [.nnn] for every precision step after seconds.
+        const size_t l_length = g_minutes_prefix_length + (l_groups > 0 ? 3 : 0) + (l_groups > 1 ? (l_groups - 1) * 4 : 0) + g_offset_length;
+        if (p_last - p_first < static_cast< std::ptrdiff_t >(l_length)) {
+            return {p_last, std::errc::value_too_large};
+        }
+        const int64_t l_now = std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::system_clock::now().time_since_epoch()).count();
+        const int64_t l_second = l_now / g_nanoseconds_in_second;
+        const auto l_fraction = static_cast< uint32_t >(l_now % g_nanoseconds_in_second);
+        if (l_second != p_cache.second && not renderSecond(l_second, p_local ? localOffset(l_second) : 0, p_cache)) {
+            return {p_last, std::errc::result_out_of_range};
+        }
+        char* l_end = std::copy_n(p_cache.prefix.data(), l_groups > 0 ? g_seconds_prefix_length : g_minutes_prefix_length, p_first);
+        const std::array< uint32_t, 3 > l_fraction_groups{l_fraction / 1000000, l_fraction / 1000 % 1000, l_fraction % 1000};
+        for (size_t l_group = 1; l_group < l_groups; ++l_group) {
+            l_end[0] = '.';
+            writeThreeDigits(l_end + 1, l_fraction_groups[l_group - 1]);
+            l_end += 4;
+        }
+        return {std::copy_n(p_cache.offset.data(), p_cache.offset.size(), l_end), std::errc{}};
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::writeLocalDateTimeNow(char* p_first, char* p_last, tristan::time::Precision p_precision) noexcept -> std::to_chars_result {
+    return writeNow(g_local_cache, true, p_first, p_last, p_precision);
+}
+
+auto tristan::date_time::writeUtcDateTimeNow(char* p_first, char* p_last, tristan::time::Precision p_precision) noexcept -> std::to_chars_result {
+    return writeNow(g_utc_cache, false, p_first, p_last, p_precision);
+}
+
+auto tristan::date_time::localDateTimeNow(tristan::time::Precision p_precision) noexcept -> std::string_view {
+    thread_local std::array< char, tristan::date_time::g_date_time_max_length > l_text;
+    const auto l_result = writeLocalDateTimeNow(l_text.data(), l_text.data() + l_text.size(), p_precision);
+    if (l_result.ec != std::errc{}) {
+        return {};
+    }
+    return {l_text.data(), static_cast< size_t >(l_result.ptr - l_text.data())};
+}
+
+auto tristan::date_time::utcDateTimeNow(tristan::time::Precision p_precision) noexcept -> std::string_view {
+    thread_local std::array< char, tristan::date_time::g_date_time_max_length > l_text;
+    const auto l_result = writeUtcDateTimeNow(l_text.data(), l_text.data() + l_text.size(), p_precision);
+    if (l_result.ec != std::errc{}) {
+        return {};
+    }
+    return {l_text.data(), static_cast< size_t >(l_result.ptr - l_text.data())};
+}
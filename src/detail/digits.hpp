@@ -0,0 +1,97 @@
+#ifndef DETAIL_DIGITS_HPP
+#define DETAIL_DIGITS_HPP
+
+#include "time.hpp"
+
+#include <array>
+#include <cstdint>
+
+/**
+ * \brief Internal helpers of decimal parsers and writers. Not installed.
+ */
+namespace tristan::detail {
+
+    inline constexpr std::array< uint64_t, 10 > g_powers_of_ten{1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+    inline constexpr int64_t g_nanoseconds_in_second = 1000000000;
+    inline constexpr int64_t g_nanoseconds_in_hour = g_nanoseconds_in_second * 3600;
+    inline constexpr int64_t g_nanoseconds_in_day = g_nanoseconds_in_hour * 24;
+
+    constexpr auto isDigit(char p_char) -> bool { return p_char >= '0' && p_char <= '9'; }
+
+    /**
+     * \brief Converts fixed width field of decimal digits.
+     * \return bool. False if field has non digit character, in which case p_value is not changed.
+     */
+    template < typename T > constexpr auto digits(const char* p_text, size_t p_width, T& p_value) -> bool {
+        uint32_t l_value = 0;
+        for (size_t l_index = 0; l_index < p_width; ++l_index) {
+            if (not isDigit(p_text[l_index])) {
+                return false;
+            }
+            l_value = l_value * 10 + static_cast< uint32_t >(p_text[l_index] - '0');
+        }
+        p_value = static_cast< T >(l_value);
+        return true;
+    }
+
+    /**
+     * \brief Converts fixed width field of decimal digits. Field has to be validated beforehand.
+     */
+    template < typename T > constexpr auto fromDigits(const char* p_digits, size_t p_width) -> T {
+        T l_value{};
+        for (size_t l_index = 0; l_index < p_width; ++l_index) {
+            l_value = static_cast< T >(l_value * 10 + (p_digits[l_index] - '0'));
+        }
+        return l_value;
+    }
+
+    static_assert(fromDigits< uint16_t >("2155", 4) == 2155);
+
+    inline constexpr auto g_two_digits = [] {
+        std::array< char, 200 > l_table{};
+        for (size_t l_index = 0; l_index < 100; ++l_index) {
+            l_table[l_index * 2] = static_cast< char >('0' + l_index / 10);
+            l_table[l_index * 2 + 1] = static_cast< char >('0' + l_index % 10);
+        }
+        return l_table;
+    }();
+
+    /**
+     * \brief Writes value less than 100 as two digits.
+     * \return Pointer past the last written character.
+     */
+    constexpr auto writeTwoDigits(char* p_buffer, uint32_t p_value) -> char* {
+        p_buffer[0] = g_two_digits[p_value * 2];
+        p_buffer[1] = g_two_digits[p_value * 2 + 1];
+        return p_buffer + 2;
+    }
+
+    /**
+     * \brief Writes value less than 1000 as three digits.
+     * \return Pointer past the last written character.
+     */
+    constexpr auto writeThreeDigits(char* p_buffer, uint32_t p_value) -> char* {
+        p_buffer[0] = static_cast< char >('0' + p_value / 100);
+        return writeTwoDigits(p_buffer + 1, p_value % 100);
+    }
+
+    /**
+     * \brief Returns the coarsest precision which holds fraction of p_digits decimal digits.
+     */
+    constexpr auto precisionFromFractionDigits(size_t p_digits) -> tristan::time::Precision {
+        if (p_digits == 0) {
+            return tristan::time::Precision::SECONDS;
+        }
+        if (p_digits <= 3) {
+            return tristan::time::Precision::MILLISECONDS;
+        }
+        if (p_digits <= 6) {
+            return tristan::time::Precision::MICROSECONDS;
+        }
+        return tristan::time::Precision::NANOSECONDS;
+    }
+
+}  // namespace tristan::detail
+
+#endif  // DETAIL_DIGITS_HPP
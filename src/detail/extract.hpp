@@ -0,0 +1,201 @@
+#ifndef DETAIL_EXTRACT_HPP
+#define DETAIL_EXTRACT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string_view>
+
+/**
+ * \brief Internal helpers of stream extractors of Date, Time and DateTime. Not installed.
+ */
+namespace tristan::detail {
+
+    /**
+     * \brief Layouts of Date representation: 'd' - decimal digit, other characters match themselves.
+     */
+    inline constexpr std::array< std::string_view, 2 > g_date_layouts{"dddd-dd-dd", "dddddddd"};
+
+    /**
+     * \brief Layouts of Time representation: 'd' - decimal digit, 's' - '+' or '-', other characters match themselves.
+     */
+    inline constexpr std::array< std::string_view, 10 > g_time_layouts{"dd:dd",
+                                                                      "dd:dd:dd",
+                                                                      "dd:dd:dd.ddd",
+                                                                      "dd:dd:dd.ddd.ddd",
+                                                                      "dd:dd:dd.ddd.ddd.ddd",
+                                                                      "dd:ddsdd",
+                                                                      "dd:dd:ddsdd",
+                                                                      "dd:dd:dd.dddsdd",
+                                                                      "dd:dd:dd.ddd.dddsdd",
+                                                                      "dd:dd:dd.ddd.ddd.dddsdd"};
+
+    /**
+     * \brief Classes of characters which layouts distinguish.
+     */
+    enum class CharClass : uint8_t {
+        DIGIT,
+        PLUS,
+        MINUS,
+        COLON,
+        DOT,
+        OTHER,
+        COUNT
+    };
+
+    constexpr auto charClass(char p_char) -> CharClass {
+        if (p_char >= '0' && p_char <= '9') {
+            return CharClass::DIGIT;
+        }
+        switch (p_char) {
+            case '+': {
+                return CharClass::PLUS;
+            }
+            case '-': {
+                return CharClass::MINUS;
+            }
+            case ':': {
+                return CharClass::COLON;
+            }
+            case '.': {
+                return CharClass::DOT;
+            }
+            default: {
+                return CharClass::OTHER;
+            }
+        }
+    }
+
+    /**
+     * \brief Layouts compiled to bit masks, bit N stands for layout N.
+     * \tparam MaxLength Length of the longest layout.
+     */
+    template < size_t MaxLength > struct LayoutTable {
+        /// Layouts which accept character class at position.
+        std::array< std::array< uint32_t, static_cast< size_t >(CharClass::COUNT) >, MaxLength > accepted{};
+        /// Layouts of length.
+        std::array< uint32_t, MaxLength + 1 > complete{};
+    };
+
+    template < size_t Count > constexpr auto maxLayoutLength(const std::array< std::string_view, Count >& p_layouts) -> size_t {
+        size_t l_length = 0;
+        for (const auto& l_layout: p_layouts) {
+            l_length = std::max(l_length, l_layout.size());
+        }
+        return l_length;
+    }
+
+    template < size_t MaxLength, size_t Count > constexpr auto makeLayoutTable(const std::array< std::string_view, Count >& p_layouts) -> LayoutTable< MaxLength > {
+        static_assert(Count <= 32, "Layout is represented by bit of uint32_t");
+        LayoutTable< MaxLength > l_table;
+        for (size_t l_index = 0; l_index < Count; ++l_index) {
+            const uint32_t l_bit = uint32_t{1} << l_index;
+            const auto l_layout = p_layouts[l_index];
+            for (size_t l_position = 0; l_position < l_layout.size(); ++l_position) {
+                auto& l_accepted = l_table.accepted[l_position];
+                switch (l_layout[l_position]) {
+                    case 'd': {
+                        l_accepted[static_cast< size_t >(CharClass::DIGIT)] |= l_bit;
+                        break;
+                    }
+                    case 's': {
+                        l_accepted[static_cast< size_t >(CharClass::PLUS)] |= l_bit;
+                        l_accepted[static_cast< size_t >(CharClass::MINUS)] |= l_bit;
+                        break;
+                    }
+                    default: {
+                        l_accepted[static_cast< size_t >(charClass(l_layout[l_position]))] |= l_bit;
+                        break;
+                    }
+                }
+            }
+            l_table.complete[l_layout.size()] |= l_bit;
+        }
+        return l_table;
+    }
+
+    inline constexpr auto g_date_table = makeLayoutTable< maxLayoutLength(g_date_layouts) >(g_date_layouts);
+    inline constexpr auto g_time_table = makeLayoutTable< maxLayoutLength(g_time_layouts) >(g_time_layouts);
+
+    /**
+     * \brief Matches text character by character against the set of layouts, keeping layouts which the text read so far is prefix of.
+     * \tparam MaxLength Length of the longest layout.
+     */
+    template < size_t MaxLength > class LayoutMatcher {
+    public:
+        constexpr explicit LayoutMatcher(const LayoutTable< MaxLength >& p_table) :
+            m_table(&p_table),
+            m_candidates(~uint32_t{0}),
+            m_length(0) { }
+
+        /**
+         * \brief Accepts the character if it continues at least one layout.
+         * \param p_char char.
+         * \return bool. False if the character can not follow the text read so far, in which case state is not changed.
+         */
+        constexpr auto extend(char p_char) -> bool {
+            if (m_length == MaxLength) {
+                return false;
+            }
+            const uint32_t l_candidates = m_candidates & m_table->accepted[m_length][static_cast< size_t >(charClass(p_char))];
+            if (l_candidates == 0) {
+                return false;
+            }
+            m_candidates = l_candidates;
+            ++m_length;
+            return true;
+        }
+
+        /**
+         * \brief Returns true if the text read so far is one of layouts as a whole.
+         * \return bool.
+         */
+        [[nodiscard]] constexpr auto complete() const -> bool { return (m_candidates & m_table->complete[m_length]) != 0; }
+
+    private:
+        const LayoutTable< MaxLength >* m_table;
+        uint32_t m_candidates;
+        size_t m_length;
+    };
+
+    /**
+     * \brief Reads characters directly from the stream buffer while they continue valid representation and parses them.
+     * Reading stops at the first character which can not follow the characters read so far, so that e.g. [2024-01-01-2024-02-01]
+     * is read as two dates. Leading whitespace is skipped according to std::ios_base::skipws.
+     * \tparam MaxLength Maximum length of representation.
+     * \param p_in std::istream&.
+     * \param p_extend Callable bool(char), accepts the next character. See LayoutMatcher::extend.
+     * \param p_parse Callable bool(std::string_view), parses characters read and assigns the value on success.
+     * \return std::istream&. std::ios_base::failbit is set if parsing fails, std::ios_base::eofbit if end of stream is reached.
+     */
+    template < size_t MaxLength, typename Extend, typename Parse > auto extract(std::istream& p_in, Extend&& p_extend, Parse&& p_parse) -> std::istream& {
+        const std::istream::sentry l_sentry(p_in);
+        if (not l_sentry) {
+            return p_in;
+        }
+        using Traits = std::istream::traits_type;
+        std::array< char, MaxLength > l_buffer;
+        size_t l_length = 0;
+        auto l_state = std::ios_base::goodbit;
+        auto* l_stream_buffer = p_in.rdbuf();
+        for (auto l_char = l_stream_buffer->sgetc();; l_char = l_stream_buffer->snextc()) {
+            if (Traits::eq_int_type(l_char, Traits::eof())) {
+                l_state |= std::ios_base::eofbit;
+                break;
+            }
+            if (l_length == l_buffer.size() || not p_extend(Traits::to_char_type(l_char))) {
+                break;
+            }
+            l_buffer[l_length++] = Traits::to_char_type(l_char);
+        }
+        if (not p_parse(std::string_view(l_buffer.data(), l_length))) {
+            l_state |= std::ios_base::failbit;
+        }
+        p_in.setstate(l_state);
+        return p_in;
+    }
+
+}  // namespace tristan::detail
+
+#endif  // DETAIL_EXTRACT_HPP
@@ -0,0 +1,235 @@
+#include "epoch_text.hpp"
+#include "detail/digits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+    using tristan::detail::g_powers_of_ten;
+    using tristan::detail::g_two_digits;
+
+    inline constexpr size_t g_max_integral_digits = 19;
+    inline constexpr size_t g_max_fraction_digits = 9;
+    inline constexpr uint64_t g_max_nanoseconds = std::numeric_limits< int64_t >::max();
+    // Largest integral part of each EpochUnit which fits into nanoseconds, so that range check needs no division.
+    inline constexpr std::array< uint64_t, 4 > g_max_integral{
+        g_max_nanoseconds / 1000000000, g_max_nanoseconds / 1000000, g_max_nanoseconds / 1000, g_max_nanoseconds};
+
+    /**
+     * \brief Returns decimal exponent of the unit relative to a second, e.g. 3 for MILLISECONDS.
+     */
+    constexpr auto unitExponent(tristan::date_time::EpochUnit p_unit) -> uint8_t { return static_cast< uint8_t >(p_unit) * 3; }
+
+    constexpr auto precisionExponent(tristan::time::Precision p_precision) -> uint8_t {
+        return p_precision == tristan::time::Precision::MINUTES ? 0 : (static_cast< uint8_t >(p_precision) - 1) * 3;
+    }
+
+    /**
+     * \brief Returns the coarsest precision which holds value with resolution of 10^-p_exponent seconds.
+     */
+    constexpr auto precisionFromExponent(size_t p_exponent) -> tristan::time::Precision {
+        if (p_exponent == 0) {
+            return tristan::time::Precision::SECONDS;
+        }
+        if (p_exponent <= 3) {
+            return tristan::time::Precision::MILLISECONDS;
+        }
+        if (p_exponent <= 6) {
+            return tristan::time::Precision::MICROSECONDS;
+        }
+        return tristan::time::Precision::NANOSECONDS;
+    }
+
+    /**
+     * \brief Returns mask which has high nibble set in every byte of p_chunk which is not a decimal digit.
+     * Carry from a non digit byte may only mark bytes which follow it, so the lowest marked byte is always exact.
+     */
+    constexpr auto nonDigits(uint64_t p_chunk) -> uint64_t {
+        const uint64_t l_values = p_chunk ^ 0x3030303030303030;
+        return (l_values | (l_values + 0x0606060606060606)) & 0xF0F0F0F0F0F0F0F0;
+    }
+
+    /**
+     * \brief Converts eight decimal digits, first digit being in the lowest byte, with three multiplications.
+     * Leading zero digits may be represented by zero bytes.
+     */
+    constexpr auto eightDigits(uint64_t p_chunk) -> uint32_t {
+        p_chunk = (p_chunk & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+        p_chunk = (p_chunk & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+        return static_cast< uint32_t >((p_chunk & 0x0000FFFF0000FFFF) * 42949672960001 >> 32);
+    }
+
+    static_assert(eightDigits(0x3837363534333231) == 12345678);
+    static_assert(eightDigits(0x3938000000000000) == 89);
+    static_assert(nonDigits(0x3837363534333231) == 0);
+    static_assert(std::countr_zero(nonDigits(0x3837362E34333231)) / 8 == 4);
+
+    /**
+     * \brief Converts run of decimal digits which starts at p_first.
+     * \return Pointer past the last digit. Value wraps around if run is longer than 19 digits.
+     */
+    auto parseDigits(const char* p_first, const char* p_last, uint64_t& p_value) -> const char* {
+        uint64_t l_value = 0;
+        if constexpr (std::endian::native == std::endian::little) {
+            while (p_last - p_first >= 8) {
+                uint64_t l_chunk;
+                std::memcpy(&l_chunk, p_first, sizeof(l_chunk));
+                const auto l_non_digits = nonDigits(l_chunk);
+                if (l_non_digits == 0) {
+                    l_value = l_value * g_powers_of_ten[8] + eightDigits(l_chunk);
+                    p_first += 8;
+                    continue;
+                }
+                const auto l_digits = static_cast< size_t >(std::countr_zero(l_non_digits) / 8);
+                if (l_digits != 0) {
+                    l_value = l_value * g_powers_of_ten[l_digits] + eightDigits(l_chunk << (64 - l_digits * 8));
+                }
+                p_value = l_value;
+                return p_first + l_digits;
+            }
+        }
+        while (p_first != p_last && *p_first >= '0' && *p_first <= '9') {
+            l_value = l_value * 10 + static_cast< uint64_t >(*p_first++ - '0');
+        }
+        p_value = l_value;
+        return p_first;
+    }
+
+    struct EpochValue {
+        std::chrono::nanoseconds since_epoch;
+        tristan::time::Precision precision;
+    };
+
+    auto parseEpoch(std::string_view p_epoch_text, tristan::date_time::EpochUnit p_unit) -> tristan::Result< EpochValue > {
+        const char* l_first = p_epoch_text.data();
+        const char* l_last = l_first + p_epoch_text.size();
+        const bool l_negative = l_first != l_last && *l_first == '-';
+        if (l_negative) {
+            ++l_first;
+        }
+        uint64_t l_integral = 0;
+        const char* l_end = parseDigits(l_first, l_last, l_integral);
+        if (l_end == l_first) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        const auto l_integral_digits = static_cast< size_t >(l_end - l_first);
+        uint64_t l_fraction = 0;
+        size_t l_fraction_digits = 0;
+        if (l_end != l_last) {
+            if (*l_end != '.') {
+                return tristan::ErrorCode::INVALID_FORMAT;
+            }
+            l_first = l_end + 1;
+            l_end = parseDigits(l_first, l_last, l_fraction);
+            l_fraction_digits = static_cast< size_t >(l_end - l_first);
+            if (l_end != l_last || l_fraction_digits == 0 || l_fraction_digits > g_max_fraction_digits) {
+                return tristan::ErrorCode::INVALID_FORMAT;
+            }
+        }
+        const auto l_unit_exponent = unitExponent(p_unit);
+        const auto l_unit_nanoseconds = g_powers_of_ten[g_max_fraction_digits - l_unit_exponent];
+        if (l_integral_digits > g_max_integral_digits || l_integral > g_max_integral[static_cast< size_t >(p_unit)]) {
+            return tristan::ErrorCode::OUT_OF_RANGE;
+        }
+        // Fraction is l_fraction * 10^-l_fraction_digits units, that is l_fraction * 10^(9 - unit exponent - fraction digits) nanoseconds.
+        const auto l_scale = static_cast< int >(g_max_fraction_digits) - l_unit_exponent - static_cast< int >(l_fraction_digits);
+        const uint64_t l_fraction_nanoseconds = l_scale >= 0 ? l_fraction * g_powers_of_ten[l_scale] : l_fraction / g_powers_of_ten[-l_scale];
+        const uint64_t l_nanoseconds = l_integral * l_unit_nanoseconds;
+        if (l_fraction_nanoseconds > g_max_nanoseconds - l_nanoseconds) {
+            return tristan::ErrorCode::OUT_OF_RANGE;
+        }
+        const auto l_magnitude = static_cast< int64_t >(l_nanoseconds + l_fraction_nanoseconds);
+        return EpochValue{std::chrono::nanoseconds(l_negative ? -l_magnitude : l_magnitude),
+                          precisionFromExponent(std::min(l_unit_exponent + l_fraction_digits, g_max_fraction_digits))};
+    }
+
+    /**
+     * \brief Writes p_value backwards ending at p_end, two digits at a time.
+     * \return Pointer to the first written character.
+     */
+    auto writeDigitsBackwards(uint64_t p_value, char* p_end) -> char* {
+        while (p_value >= 100) {
+            const auto l_pair = static_cast< size_t >(p_value % 100) * 2;
+            p_value /= 100;
+            *--p_end = g_two_digits[l_pair + 1];
+            *--p_end = g_two_digits[l_pair];
+        }
+        if (p_value >= 10) {
+            const auto l_pair = static_cast< size_t >(p_value) * 2;
+            *--p_end = g_two_digits[l_pair + 1];
+            *--p_end = g_two_digits[l_pair];
+        } else {
+            *--p_end = static_cast< char >('0' + p_value);
+        }
+        return p_end;
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::tryParseEpoch(std::string_view p_epoch_text, tristan::date_time::EpochUnit p_unit) noexcept
+    -> tristan::Result< tristan::date_time::DateTime > {
+    auto l_value = parseEpoch(p_epoch_text, p_unit);
+    if (not l_value) {
+        return l_value.error();
+    }
+    return tristan::date_time::DateTime::fromSinceEpoch(l_value->since_epoch, l_value->precision);
+}
+
+auto tristan::date_time::tryParseEpochSinceEpoch(std::string_view p_epoch_text, tristan::date_time::EpochUnit p_unit) noexcept
+    -> tristan::Result< std::chrono::nanoseconds > {
+    auto l_value = parseEpoch(p_epoch_text, p_unit);
+    if (not l_value) {
+        return l_value.error();
+    }
+    return std::chrono::nanoseconds(l_value->since_epoch);
+}
+
+auto tristan::date_time::writeEpoch(const tristan::date_time::DateTime& p_date_time,
+                                    tristan::date_time::EpochUnit p_unit,
+                                    uint8_t p_fraction_digits,
+                                    std::span< char, g_epoch_text_max_length > p_buffer) -> size_t {
+    if (p_fraction_digits > g_max_fraction_digits) {
+        throw std::invalid_argument("tristan::date_time::writeEpoch: Number of fraction digits should be in range 0 - 9");
+    }
+    const auto l_since_epoch = p_date_time.sinceEpoch().count();
+    // Magnitude is computed in unsigned arithmetic to handle the lowest int64_t value.
+    const uint64_t l_magnitude = l_since_epoch < 0 ? 0 - static_cast< uint64_t >(l_since_epoch) : static_cast< uint64_t >(l_since_epoch);
+    const auto l_unit_exponent = unitExponent(p_unit);
+    const auto l_unit_nanoseconds = g_powers_of_ten[g_max_fraction_digits - l_unit_exponent];
+
+    std::array< char, g_max_integral_digits + 1 + g_max_fraction_digits > l_digits{};
+    char* l_point = l_digits.data() + g_max_integral_digits;
+    char* l_first = writeDigitsBackwards(l_magnitude / l_unit_nanoseconds, l_point);
+    size_t l_length = static_cast< size_t >(l_point - l_first);
+    if (p_fraction_digits != 0) {
+        *l_point = '.';
+        // Nine digit fraction of the unit. Digits beyond nanosecond resolution are zeros.
+        const uint64_t l_fraction = l_magnitude % l_unit_nanoseconds * g_powers_of_ten[l_unit_exponent];
+        char* l_fraction_end = l_point + 1 + g_max_fraction_digits;
+        char* l_fraction_first = writeDigitsBackwards(l_fraction, l_fraction_end);
+        std::fill(l_point + 1, l_fraction_first, '0');
+        l_length += 1 + p_fraction_digits;
+    }
+    size_t l_written = 0;
+    if (l_since_epoch < 0) {
+        p_buffer[l_written++] = '-';
+    }
+    std::memcpy(p_buffer.data() + l_written, l_first, l_length);
+    return l_written + l_length;
+}
+
+auto tristan::date_time::toEpochString(const tristan::date_time::DateTime& p_date_time, tristan::date_time::EpochUnit p_unit) -> std::string {
+    const auto l_precision_exponent = precisionExponent(p_date_time.time().precision());
+    const auto l_unit_exponent = unitExponent(p_unit);
+    return toEpochString(p_date_time, p_unit, static_cast< uint8_t >(l_precision_exponent > l_unit_exponent ? l_precision_exponent - l_unit_exponent : 0));
+}
+
+auto tristan::date_time::toEpochString(const tristan::date_time::DateTime& p_date_time, tristan::date_time::EpochUnit p_unit, uint8_t p_fraction_digits)
+    -> std::string {
+    std::array< char, g_epoch_text_max_length > l_buffer;
+    const auto l_length = writeEpoch(p_date_time, p_unit, p_fraction_digits, l_buffer);
+    return {l_buffer.data(), l_length};
+}
@@ -0,0 +1,170 @@
+#include "format_detector.hpp"
+#include "epoch_text.hpp"
+#include "rfc3339.hpp"
+#include "detail/digits.hpp"
+
+#include <array>
+
+namespace {
+
+    using tristan::detail::g_powers_of_ten;
+    using tristan::detail::isDigit;
+    using tristan::detail::precisionFromFractionDigits;
+
+    /**
+     * \brief Fields of SQL timestamps. Ranges are not validated.
+     */
+    struct CivilFields {
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+        uint8_t hours;
+        uint8_t minutes;
+        uint8_t seconds;
+        uint32_t fraction_nanoseconds;
+        tristan::time::Precision precision;
+    };
+
+    /**
+     * \brief Converts fixed width field of decimal digits at p_pos.
+     * \return false if field is out of the string or has non digit character.
+     */
+    template < typename T > auto digits(std::string_view p_text, size_t p_pos, size_t p_width, T& p_value) -> bool {
+        return p_pos + p_width <= p_text.size() && tristan::detail::digits(p_text.data() + p_pos, p_width, p_value);
+    }
+
+    /**
+     * \brief Parses optional fraction of 1 to 9 digits which starts with '.' at p_pos.
+     * \return Position after the fraction or 0 if fraction is malformed.
+     */
+    auto parseFraction(std::string_view p_text, size_t p_pos, uint32_t& p_nanoseconds, tristan::time::Precision& p_precision) -> size_t {
+        p_nanoseconds = 0;
+        p_precision = tristan::time::Precision::SECONDS;
+        if (p_pos >= p_text.size() || p_text[p_pos] != '.') {
+            return p_pos;
+        }
+        size_t l_end = ++p_pos;
+        while (l_end < p_text.size() && isDigit(p_text[l_end])) {
+            ++l_end;
+        }
+        const size_t l_digits = l_end - p_pos;
+        if (l_digits == 0 || l_digits > 9) {
+            return 0;
+        }
+        uint32_t l_value = 0;
+        digits(p_text, p_pos, l_digits, l_value);
+        p_nanoseconds = static_cast< uint32_t >(l_value * g_powers_of_ten[9 - l_digits]);
+        p_precision = precisionFromFractionDigits(l_digits);
+        return l_end;
+    }
+
+    /**
+     * \brief Parses [YYYY-MM-DD HH:MM:SS[.f]].
+     * \return Position after the fraction or 0 if record is malformed.
+     */
+    auto parseCivil(std::string_view p_text, CivilFields& p_fields) -> size_t {
+        if (p_text.size() < 19 || p_text[4] != '-' || p_text[7] != '-' || p_text[10] != ' ' || p_text[13] != ':'
+            || p_text[16] != ':') {
+            return 0;
+        }
+        if (not digits(p_text, 0, 4, p_fields.year) || not digits(p_text, 5, 2, p_fields.month) || not digits(p_text, 8, 2, p_fields.day)
+            || not digits(p_text, 11, 2, p_fields.hours) || not digits(p_text, 14, 2, p_fields.minutes) || not digits(p_text, 17, 2, p_fields.seconds)) {
+            return 0;
+        }
+        return parseFraction(p_text, 19, p_fields.fraction_nanoseconds, p_fields.precision);
+    }
+
+    auto makeDateTime(const CivilFields& p_fields) -> tristan::Result< tristan::date_time::DateTime > {
+        auto l_date = tristan::date::Date::tryCreate(p_fields.day, p_fields.month, p_fields.year);
+        if (not l_date) {
+            return l_date.error();
+        }
+        auto l_time = tristan::time::Time::tryCreate(p_fields.precision,
+                                                     p_fields.hours,
+                                                     p_fields.minutes,
+                                                     p_fields.seconds,
+                                                     static_cast< uint16_t >(p_fields.fraction_nanoseconds / 1000000),
+                                                     static_cast< uint16_t >(p_fields.fraction_nanoseconds / 1000 % 1000),
+                                                     static_cast< uint16_t >(p_fields.fraction_nanoseconds % 1000));
+        if (not l_time) {
+            return l_time.error();
+        }
+        return tristan::date_time::DateTime(std::move(l_date).value(), std::move(l_time).value());
+    }
+
+    auto parseSql(std::string_view p_timestamp) -> tristan::Result< tristan::date_time::DateTime > {
+        CivilFields l_fields{};
+        auto l_end = parseCivil(p_timestamp, l_fields);
+        if (l_end == 0 || l_end != p_timestamp.size()) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        return makeDateTime(l_fields);
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::FormatDetector::detect(std::string_view p_timestamp) noexcept -> tristan::date_time::TimestampFormat {
+    const size_t l_size = p_timestamp.size();
+    if (l_size >= 11 && p_timestamp[4] == '-' && p_timestamp[7] == '-') {
+        if (p_timestamp[10] == ' ') {
+            return tristan::date_time::TimestampFormat::SQL;
+        }
+        if (p_timestamp[10] != 'T' && p_timestamp[10] != 't') {
+            return tristan::date_time::TimestampFormat::UNKNOWN;
+        }
+        const char l_last = p_timestamp[l_size - 1];
+        if (l_last == 'Z' || l_last == 'z' || (p_timestamp[l_size - 3] == ':' && (p_timestamp[l_size - 6] == '+' || p_timestamp[l_size - 6] == '-'))) {
+            return tristan::date_time::TimestampFormat::RFC_3339;
+        }
+        return tristan::date_time::TimestampFormat::ISO_EXTENDED;
+    }
+    if (l_size >= 9 && p_timestamp[8] == 'T') {
+        return tristan::date_time::TimestampFormat::ISO_BASIC;
+    }
+    if (l_size > 0 && (isDigit(p_timestamp[0]) || p_timestamp[0] == '-')) {
+        return tristan::date_time::TimestampFormat::EPOCH_SECONDS;
+    }
+    return tristan::date_time::TimestampFormat::UNKNOWN;
+}
+
+auto tristan::date_time::FormatDetector::tryParseAs(std::string_view p_timestamp, tristan::date_time::TimestampFormat p_format) noexcept
+    -> tristan::Result< tristan::date_time::DateTime > {
+    switch (p_format) {
+        case tristan::date_time::TimestampFormat::ISO_BASIC:
+        case tristan::date_time::TimestampFormat::ISO_EXTENDED: {
+            return tristan::date_time::DateTime::tryParse(p_timestamp);
+        }
+        case tristan::date_time::TimestampFormat::SQL: {
+            return parseSql(p_timestamp);
+        }
+        case tristan::date_time::TimestampFormat::RFC_3339: {
+            return tristan::date_time::tryParseRfc3339(p_timestamp);
+        }
+        case tristan::date_time::TimestampFormat::EPOCH_SECONDS: {
+            return tristan::date_time::tryParseEpoch(p_timestamp);
+        }
+        case tristan::date_time::TimestampFormat::UNKNOWN:
+        default: {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+    }
+}
+
+auto tristan::date_time::FormatDetector::tryParse(std::string_view p_timestamp) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    if (m_last_format != tristan::date_time::TimestampFormat::UNKNOWN) {
+        auto l_result = tryParseAs(p_timestamp, m_last_format);
+        // If detection agrees with the remembered format the record is just invalid.
+        if (l_result || detect(p_timestamp) == m_last_format) {
+            return l_result;
+        }
+    }
+    auto l_format = detect(p_timestamp);
+    auto l_result = tryParseAs(p_timestamp, l_format);
+    if (l_result) {
+        m_last_format = l_format;
+    }
+    return l_result;
+}
+
+auto tristan::date_time::FormatDetector::parse(std::string_view p_timestamp) -> tristan::date_time::DateTime {
+    return tryParse(p_timestamp).valueOrThrow("tristan::date_time::FormatDetector::parse(std::string_view p_timestamp)");
+}
@@ -0,0 +1,197 @@
+#include "format_pattern.hpp"
+#include "detail/digits.hpp"
+
+namespace {
+
+    using tristan::detail::g_powers_of_ten;
+    using tristan::detail::writeTwoDigits;
+
+    auto writeDigits(char* p_buffer, uint32_t p_value, size_t p_width) -> char* {
+        for (size_t l_pos = p_width; l_pos > 0; --l_pos) {
+            p_buffer[l_pos - 1] = static_cast< char >('0' + p_value % 10);
+            p_value /= 10;
+        }
+        return p_buffer + p_width;
+    }
+
+    auto writeName(char* p_buffer, std::string_view p_name) -> char* { return p_buffer + p_name.copy(p_buffer, p_name.size()); }
+
+    auto fractionDigits(tristan::time::Precision p_precision) -> size_t {
+        if (p_precision <= tristan::time::Precision::MILLISECONDS) {
+            return 3;
+        }
+        return p_precision == tristan::time::Precision::MICROSECONDS ? 6 : 9;
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::FormatPattern::write(const tristan::date_time::DateTime& p_date_time, char* p_first, char* p_last) const noexcept
+    -> std::to_chars_result {
+    if (p_last - p_first < static_cast< std::ptrdiff_t >(m_max_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    Fields l_fields{};
+    if (m_uses_date) {
+        _decodeDate(p_date_time.date(), l_fields);
+    }
+    if (m_uses_time) {
+        _decodeTime(p_date_time.time(), l_fields);
+    }
+    return {_write(l_fields, p_first), std::errc{}};
+}
+
+auto tristan::date_time::FormatPattern::format(const tristan::date_time::DateTime& p_date_time) const -> std::string {
+    std::array< char, max_length > l_buffer;
+    const auto l_result = write(p_date_time, l_buffer.data(), l_buffer.data() + l_buffer.size());
+    return {l_buffer.data(), l_result.ptr};
+}
+
+auto tristan::date_time::FormatPattern::write(const tristan::date::Date& p_date, char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    if (m_uses_time) {
+        return {p_last, std::errc::invalid_argument};
+    }
+    if (p_last - p_first < static_cast< std::ptrdiff_t >(m_max_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    Fields l_fields{};
+    _decodeDate(p_date, l_fields);
+    return {_write(l_fields, p_first), std::errc{}};
+}
+
+auto tristan::date_time::FormatPattern::write(const tristan::time::Time& p_time, char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    if (m_uses_date) {
+        return {p_last, std::errc::invalid_argument};
+    }
+    if (p_last - p_first < static_cast< std::ptrdiff_t >(m_max_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    Fields l_fields{};
+    _decodeTime(p_time, l_fields);
+    return {_write(l_fields, p_first), std::errc{}};
+}
+
+auto tristan::date_time::FormatPattern::format(const tristan::date::Date& p_date) const -> std::string {
+    if (m_uses_time) {
+        throw std::invalid_argument("tristan::date_time::FormatPattern::format(const date::Date& p_date): Pattern has time conversions");
+    }
+    std::array< char, max_length > l_buffer;
+    const auto l_result = write(p_date, l_buffer.data(), l_buffer.data() + l_buffer.size());
+    return {l_buffer.data(), l_result.ptr};
+}
+
+auto tristan::date_time::FormatPattern::format(const tristan::time::Time& p_time) const -> std::string {
+    if (m_uses_date) {
+        throw std::invalid_argument("tristan::date_time::FormatPattern::format(const time::Time& p_time): Pattern has date conversions");
+    }
+    std::array< char, max_length > l_buffer;
+    const auto l_result = write(p_time, l_buffer.data(), l_buffer.data() + l_buffer.size());
+    return {l_buffer.data(), l_result.ptr};
+}
+
+auto tristan::date_time::FormatPattern::toFormatter() const -> tristan::date_time::Formatter {
+    return [l_pattern = *this](const tristan::date_time::DateTime& p_date_time) {
+        return l_pattern.format(p_date_time);
+    };
+}
+
+auto tristan::date_time::FormatPattern::toDateFormatter() const -> tristan::date::Formatter {
+    if (m_uses_time) {
+        throw std::invalid_argument("tristan::date_time::FormatPattern::toDateFormatter(): Pattern has time conversions");
+    }
+    return [l_pattern = *this](const tristan::date::Date& p_date) {
+        return l_pattern.format(p_date);
+    };
+}
+
+auto tristan::date_time::FormatPattern::toTimeFormatter() const -> tristan::time::Formatter {
+    if (m_uses_date) {
+        throw std::invalid_argument("tristan::date_time::FormatPattern::toTimeFormatter(): Pattern has date conversions");
+    }
+    return [l_pattern = *this](const tristan::time::Time& p_time) {
+        return l_pattern.format(p_time);
+    };
+}
+
+void tristan::date_time::FormatPattern::_decodeDate(const tristan::date::Date& p_date, Fields& p_fields) const noexcept {
+    const auto l_days_since_epoch = p_date.daysSinceEpoch();
+    p_fields.date = tristan::date::civilFromDays(l_days_since_epoch);
+    p_fields.day_of_the_week = p_date.dayOfTheWeek();
+    if (m_uses_day_of_the_year) {
+        p_fields.day_of_the_year = tristan::date::dayOfTheYearFromDaysSinceEpoch(l_days_since_epoch);
+    }
+}
+
+void tristan::date_time::FormatPattern::_decodeTime(const tristan::time::Time& p_time, Fields& p_fields) noexcept {
+    const auto l_since_day_start = static_cast< uint64_t >(p_time.sinceDayStart().count());
+    p_fields.seconds_since_day_start = static_cast< uint32_t >(l_since_day_start / g_powers_of_ten[9]);
+    p_fields.fraction_nanoseconds = static_cast< uint32_t >(l_since_day_start % g_powers_of_ten[9]);
+    p_fields.precision = p_time.precision();
+    p_fields.offset = static_cast< int8_t >(p_time.offset());
+}
+
+auto tristan::date_time::FormatPattern::_write(const Fields& p_fields, char* p_buffer) const noexcept -> char* {
+    for (uint8_t l_index = 0; l_index < m_steps_count; ++l_index) {
+        const auto& l_step = m_steps[l_index];
+        switch (l_step.field) {
+            case Field::YEAR: {
+                p_buffer = writeTwoDigits(p_buffer, p_fields.date.year / 100);
+                p_buffer = writeTwoDigits(p_buffer, p_fields.date.year % 100);
+                break;
+            }
+            case Field::MONTH: {
+                p_buffer = writeTwoDigits(p_buffer, p_fields.date.month);
+                break;
+            }
+            case Field::DAY: {
+                p_buffer = writeTwoDigits(p_buffer, p_fields.date.day);
+                break;
+            }
+            case Field::DAY_OF_THE_YEAR: {
+                p_buffer = writeDigits(p_buffer, p_fields.day_of_the_year, 3);
+                break;
+            }
+            case Field::DAY_ABBREVIATION: {
+                p_buffer = writeName(p_buffer, m_names->weekday_abbreviations[p_fields.day_of_the_week]);
+                break;
+            }
+            case Field::DAY_NAME: {
+                p_buffer = writeName(p_buffer, m_names->weekdays[p_fields.day_of_the_week]);
+                break;
+            }
+            case Field::MONTH_ABBREVIATION: {
+                p_buffer = writeName(p_buffer, m_names->month_abbreviations[p_fields.date.month - 1]);
+                break;
+            }
+            case Field::MONTH_NAME: {
+                p_buffer = writeName(p_buffer, m_names->months[p_fields.date.month - 1]);
+                break;
+            }
+            case Field::HOURS: {
+                p_buffer = writeTwoDigits(p_buffer, p_fields.seconds_since_day_start / 3600);
+                break;
+            }
+            case Field::MINUTES: {
+                p_buffer = writeTwoDigits(p_buffer, p_fields.seconds_since_day_start / 60 % 60);
+                break;
+            }
+            case Field::SECONDS: {
+                p_buffer = writeTwoDigits(p_buffer, p_fields.seconds_since_day_start % 60);
+                break;
+            }
+            case Field::FRACTION: {
+                const size_t l_digits = l_step.argument == 0 ? fractionDigits(p_fields.precision) : static_cast< size_t >(l_step.argument);
+                p_buffer = writeDigits(p_buffer, static_cast< uint32_t >(p_fields.fraction_nanoseconds / g_powers_of_ten[9 - l_digits]), l_digits);
+                break;
+            }
+            case Field::OFFSET: {
+                *p_buffer++ = p_fields.offset < 0 ? '-' : '+';
+                p_buffer = writeTwoDigits(p_buffer, static_cast< uint32_t >(p_fields.offset < 0 ? -p_fields.offset : p_fields.offset));
+                break;
+            }
+            case Field::LITERAL: {
+                *p_buffer++ = l_step.argument;
+                break;
+            }
+        }
+    }
+    return p_buffer;
+}
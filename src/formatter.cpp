@@ -0,0 +1,43 @@
+#include "formatter.hpp"
+
+auto tristan::date_time::FormatSpec::write(const tristan::date_time::DateTime& p_date_time, char* p_first, char* p_last) const noexcept
+    -> std::to_chars_result {
+    if (m_has_pattern) {
+        return m_pattern.write(p_date_time, p_first, p_last);
+    }
+    if (not m_has_precision) {
+        return p_date_time.toChars(p_first, p_last);
+    }
+    if (p_last - p_first <= static_cast< std::ptrdiff_t >(tristan::date::g_date_max_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    auto l_result = write(p_date_time.time(), p_first + tristan::date::g_date_max_length + 1, p_last);
+    if (l_result.ec != std::errc{}) {
+        return l_result;
+    }
+    p_date_time.date().toChars(p_first, p_first + tristan::date::g_date_max_length);
+    p_first[tristan::date::g_date_max_length] = 'T';
+    return l_result;
+}
+
+auto tristan::date_time::FormatSpec::write(const tristan::date::Date& p_date, char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    if (m_has_pattern) {
+        return m_pattern.write(p_date, p_first, p_last);
+    }
+    if (m_has_precision) {
+        return {p_last, std::errc::invalid_argument};
+    }
+    return p_date.toChars(p_first, p_last);
+}
+
+auto tristan::date_time::FormatSpec::write(const tristan::time::Time& p_time, char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    if (m_has_pattern) {
+        return m_pattern.write(p_time, p_first, p_last);
+    }
+    if (not m_has_precision || p_time.precision() == m_precision) {
+        return p_time.toChars(p_first, p_last);
+    }
+    // Time which is created from time since day start does not have formatter, so copy is cheap and does not allocate.
+    auto l_time = tristan::time::Time::fromSinceDayStart(p_time.sinceDayStart(), m_precision, p_time.offset());
+    return l_time->toChars(p_first, p_last);
+}
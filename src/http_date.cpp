@@ -0,0 +1,159 @@
+#include "http_date.hpp"
+#include "calendar_names.hpp"
+#include "detail/digits.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+    using tristan::detail::digits;
+    using tristan::detail::writeTwoDigits;
+
+    inline constexpr size_t g_http_date_words = (tristan::date_time::g_http_date_length + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    /**
+     * \brief Value of httpDateNow shared by all threads. Text is kept in atomic words guarded by the sequence counter (seqlock),
+     * which is odd while value is written, so that readers detect and skip partially written value.
+     */
+    struct HttpDateCache {
+        std::atomic< uint32_t > sequence{0};
+        std::atomic< int64_t > second{std::numeric_limits< int64_t >::min()};
+        std::array< std::atomic< uint64_t >, g_http_date_words > words{};
+    };
+
+    HttpDateCache g_http_date_cache;
+    std::atomic< bool > g_http_date_updating{false};
+
+    auto loadHttpDate(int64_t p_second, std::span< char, tristan::date_time::g_http_date_length > p_buffer) -> bool {
+        const auto l_sequence = g_http_date_cache.sequence.load(std::memory_order_acquire);
+        if (l_sequence % 2 != 0 || g_http_date_cache.second.load(std::memory_order_relaxed) != p_second) {
+            return false;
+        }
+        std::array< uint64_t, g_http_date_words > l_words{};
+        for (size_t l_index = 0; l_index < g_http_date_words; ++l_index) {
+            l_words[l_index] = g_http_date_cache.words[l_index].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (g_http_date_cache.sequence.load(std::memory_order_relaxed) != l_sequence) {
+            return false;
+        }
+        std::memcpy(p_buffer.data(), l_words.data(), p_buffer.size());
+        return true;
+    }
+
+    /**
+     * \brief Publishes value of the second unless newer one is published already. Has to be called by one thread at a time.
+     */
+    void storeHttpDate(int64_t p_second, std::span< const char, tristan::date_time::g_http_date_length > p_text) {
+        if (g_http_date_cache.second.load(std::memory_order_relaxed) >= p_second) {
+            return;
+        }
+        std::array< uint64_t, g_http_date_words > l_words{};
+        std::memcpy(l_words.data(), p_text.data(), p_text.size());
+        const auto l_sequence = g_http_date_cache.sequence.load(std::memory_order_relaxed);
+        g_http_date_cache.sequence.store(l_sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        g_http_date_cache.second.store(p_second, std::memory_order_relaxed);
+        for (size_t l_index = 0; l_index < g_http_date_words; ++l_index) {
+            g_http_date_cache.words[l_index].store(l_words[l_index], std::memory_order_relaxed);
+        }
+        g_http_date_cache.sequence.store(l_sequence + 2, std::memory_order_release);
+    }
+
+    void renderHttpDate(int64_t p_second, std::span< char, tristan::date_time::g_http_date_length > p_buffer) {
+        auto l_date_time = tristan::date_time::DateTime::fromSinceEpoch(std::chrono::seconds{p_second}, tristan::time::Precision::SECONDS);
+        if (l_date_time) {
+            tristan::date_time::writeHttpDate(*l_date_time, p_buffer);
+        }
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::tryParseHttpDate(std::string_view p_http_date) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    if (p_http_date.size() != g_http_date_length) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    const char* l_text = p_http_date.data();
+    if (l_text[3] != ',' || l_text[4] != ' ' || l_text[7] != ' ' || l_text[11] != ' ' || l_text[16] != ' ' || l_text[19] != ':' || l_text[22] != ':'
+        || p_http_date.substr(25) != " GMT") {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    const auto l_month = tristan::date_time::monthFromAbbreviation(l_text + 8);
+    if (l_month == 0 || tristan::date_time::weekdayFromAbbreviation(l_text) < 0) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    uint8_t l_day = 0;
+    uint16_t l_year = 0;
+    uint8_t l_hours = 0;
+    uint8_t l_minutes = 0;
+    uint8_t l_seconds = 0;
+    if (not digits(l_text + 5, 2, l_day) || not digits(l_text + 12, 4, l_year) || not digits(l_text + 17, 2, l_hours) || not digits(l_text + 20, 2, l_minutes)
+        || not digits(l_text + 23, 2, l_seconds)) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    auto l_date = tristan::date::Date::tryCreate(l_day, l_month, l_year);
+    if (not l_date) {
+        return l_date.error();
+    }
+    auto l_time = tristan::time::Time::tryCreate(tristan::time::Precision::SECONDS, l_hours, l_minutes, l_seconds);
+    if (not l_time) {
+        return l_time.error();
+    }
+    return tristan::date_time::DateTime(std::move(l_date).value(), std::move(l_time).value());
+}
+
+void tristan::date_time::writeHttpDate(const tristan::date_time::DateTime& p_date_time, std::span< char, g_http_date_length > p_buffer) {
+    if (p_date_time.time().offset() != tristan::TimeZone::UTC) {
+        auto l_gmt = tristan::date_time::DateTime::fromSinceEpoch(p_date_time.sinceEpoch(), tristan::time::Precision::SECONDS);
+        if (l_gmt) {
+            writeHttpDate(*l_gmt, p_buffer);
+            return;
+        }
+    }
+    const auto& l_date = p_date_time.date();
+    const auto& l_time = p_date_time.time();
+    char* l_buffer = p_buffer.data();
+    tristan::date_time::weekdayAbbreviation(l_date.dayOfTheWeek()).copy(l_buffer, 3);
+    l_buffer[3] = ',';
+    l_buffer[4] = ' ';
+    writeTwoDigits(l_buffer + 5, l_date.dayOfTheMonth());
+    l_buffer[7] = ' ';
+    tristan::date_time::monthAbbreviation(l_date.month()).copy(l_buffer + 8, 3);
+    l_buffer[11] = ' ';
+    const auto l_year = l_date.year();
+    writeTwoDigits(l_buffer + 12, static_cast< uint32_t >(l_year / 100));
+    writeTwoDigits(l_buffer + 14, static_cast< uint32_t >(l_year % 100));
+    l_buffer[16] = ' ';
+    writeTwoDigits(l_buffer + 17, l_time.hours());
+    l_buffer[19] = ':';
+    writeTwoDigits(l_buffer + 20, l_time.minutes());
+    l_buffer[22] = ':';
+    writeTwoDigits(l_buffer + 23, l_time.seconds());
+    std::string_view(" GMT").copy(l_buffer + 25, 4);
+}
+
+auto tristan::date_time::toHttpDate(const tristan::date_time::DateTime& p_date_time) -> std::string {
+    std::string l_http_date(g_http_date_length, ' ');
+    writeHttpDate(p_date_time, std::span< char, g_http_date_length >(l_http_date.data(), g_http_date_length));
+    return l_http_date;
+}
+
+auto tristan::date_time::httpDateNow() -> std::string_view {
+    thread_local int64_t l_cached_second = std::numeric_limits< int64_t >::min();
+    thread_local std::array< char, g_http_date_length > l_text;
+    const auto l_second = std::chrono::duration_cast< std::chrono::seconds >(std::chrono::system_clock::now().time_since_epoch()).count();
+    if (l_second != l_cached_second) {
+        if (not loadHttpDate(l_second, l_text)) {
+            renderHttpDate(l_second, l_text);
+            // Value is rendered by other thread meanwhile if the flag is taken, the next second is published by whoever comes first.
+            if (not g_http_date_updating.exchange(true, std::memory_order_acquire)) {
+                storeHttpDate(l_second, l_text);
+                g_http_date_updating.store(false, std::memory_order_release);
+            }
+        }
+        l_cached_second = l_second;
+    }
+    return {l_text.data(), l_text.size()};
+}
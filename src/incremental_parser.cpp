@@ -0,0 +1,175 @@
+#include "incremental_parser.hpp"
+#include "detail/digits.hpp"
+
+#include <cstring>
+
+namespace {
+
+    inline constexpr size_t g_minute_prefix_length = 5;
+
+    /**
+     * \brief Template of [HH:MM:SS.mmm.uuu.nnn]. 'd' stands for digit.
+     */
+    inline constexpr std::string_view g_time_template = "dd:dd:dd.ddd.ddd.ddd";
+
+    using tristan::detail::fromDigits;
+    using tristan::detail::isDigit;
+
+    auto precisionFromLength(size_t p_length) -> std::optional< tristan::time::Precision > {
+        switch (p_length) {
+            case 5: {
+                return tristan::time::Precision::MINUTES;
+            }
+            case 8: {
+                return tristan::time::Precision::SECONDS;
+            }
+            case 12: {
+                return tristan::time::Precision::MILLISECONDS;
+            }
+            case 16: {
+                return tristan::time::Precision::MICROSECONDS;
+            }
+            case 20: {
+                return tristan::time::Precision::NANOSECONDS;
+            }
+            default: {
+                return std::nullopt;
+            }
+        }
+    }
+}  //End of unnamed namespace
+
+tristan::date_time::IncrementalParser::IncrementalParser(tristan::date_time::ParserBackend p_backend) :
+    m_days_since_epoch(0),
+    m_date_prefix{},
+    m_date_prefix_length(0),
+    m_minute_prefix{},
+    m_minute_prefix_set(false),
+    m_hours(0),
+    m_minutes(0),
+    m_backend(p_backend) { }
+
+auto tristan::date_time::IncrementalParser::tryParse(std::string_view p_date_time) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    if (_matchesDatePrefix(p_date_time)) {
+        auto l_time = _tryParseTime(p_date_time.substr(m_date_prefix_length));
+        if (not l_time) {
+            return l_time.error();
+        }
+        return tristan::date_time::DateTime(tristan::date::Date(*m_date), std::move(l_time).value());
+    }
+    auto l_result = tristan::date_time::DateTime::tryParse(p_date_time, m_backend);
+    if (l_result) {
+        _rememberDate(p_date_time, l_result->date());
+        _rememberMinute(p_date_time.substr(m_date_prefix_length), l_result->time());
+    }
+    return l_result;
+}
+
+auto tristan::date_time::IncrementalParser::parse(std::string_view p_date_time) -> tristan::date_time::DateTime {
+    return tryParse(p_date_time).valueOrThrow("tristan::date_time::IncrementalParser::parse(std::string_view p_date_time)");
+}
+
+auto tristan::date_time::IncrementalParser::tryParseSinceEpoch(std::string_view p_date_time) noexcept -> tristan::Result< std::chrono::nanoseconds > {
+    if (_matchesDatePrefix(p_date_time)) {
+        auto l_time = p_date_time.substr(m_date_prefix_length);
+        if (m_minute_prefix_set && l_time.size() >= g_minute_prefix_length
+            && std::memcmp(l_time.data(), m_minute_prefix.data(), g_minute_prefix_length) == 0) {
+            if (auto l_suffix = _tryParseTimeSuffix(l_time); l_suffix) {
+                return std::chrono::nanoseconds(tristan::date::Days{m_days_since_epoch} + std::chrono::hours{m_hours} + std::chrono::minutes{m_minutes}
+                                                + std::chrono::seconds{l_suffix->seconds} + std::chrono::milliseconds{l_suffix->milliseconds}
+                                                + std::chrono::microseconds{l_suffix->microseconds} + std::chrono::nanoseconds{l_suffix->nanoseconds}
+                                                - std::chrono::hours{static_cast< int8_t >(l_suffix->offset)});
+            }
+        }
+    }
+    auto l_result = tryParse(p_date_time);
+    if (not l_result) {
+        return l_result.error();
+    }
+    return l_result->sinceEpoch();
+}
+
+void tristan::date_time::IncrementalParser::reset() noexcept {
+    m_date.reset();
+    m_date_prefix_length = 0;
+    m_minute_prefix_set = false;
+}
+
+auto tristan::date_time::IncrementalParser::_matchesDatePrefix(std::string_view p_date_time) const noexcept -> bool {
+    return m_date && p_date_time.size() > m_date_prefix_length && std::memcmp(p_date_time.data(), m_date_prefix.data(), m_date_prefix_length) == 0;
+}
+
+auto tristan::date_time::IncrementalParser::_tryParseTimeSuffix(std::string_view p_time) const noexcept -> std::optional< TimeSuffix > {
+    TimeSuffix l_suffix{};
+    l_suffix.offset = tristan::TimeZone::UTC;
+    auto l_size = p_time.size();
+    if (l_size > 3 && (p_time[l_size - 3] == '+' || p_time[l_size - 3] == '-')) {
+        if (not isDigit(p_time[l_size - 2]) || not isDigit(p_time[l_size - 1])) {
+            return std::nullopt;
+        }
+        auto l_offset_hours = fromDigits< int8_t >(p_time.data() + l_size - 2, 2);
+        if (l_offset_hours > static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+            return std::nullopt;
+        }
+        l_suffix.offset = static_cast< tristan::TimeZone >(p_time[l_size - 3] == '-' ? -l_offset_hours : l_offset_hours);
+        l_size -= 3;
+    }
+    auto l_precision = precisionFromLength(l_size);
+    if (not l_precision) {
+        return std::nullopt;
+    }
+    l_suffix.precision = *l_precision;
+    // [HH:MM] is the same as in the previously accepted record, so only the rest is validated.
+    for (size_t l_index = g_minute_prefix_length; l_index < l_size; ++l_index) {
+        if (g_time_template[l_index] == 'd' ? not isDigit(p_time[l_index]) : p_time[l_index] != g_time_template[l_index]) {
+            return std::nullopt;
+        }
+    }
+    const char* l_data = p_time.data();
+    l_suffix.seconds = l_size >= 8 ? fromDigits< uint8_t >(l_data + 6, 2) : uint8_t{0};
+    l_suffix.milliseconds = l_size >= 12 ? fromDigits< uint16_t >(l_data + 9, 3) : uint16_t{0};
+    l_suffix.microseconds = l_size >= 16 ? fromDigits< uint16_t >(l_data + 13, 3) : uint16_t{0};
+    l_suffix.nanoseconds = l_size >= 20 ? fromDigits< uint16_t >(l_data + 17, 3) : uint16_t{0};
+    if (l_suffix.seconds > 59) {
+        return std::nullopt;
+    }
+    return l_suffix;
+}
+
+auto tristan::date_time::IncrementalParser::_tryParseTime(std::string_view p_time) noexcept -> tristan::Result< tristan::time::Time > {
+    if (m_minute_prefix_set && p_time.size() >= g_minute_prefix_length
+        && std::memcmp(p_time.data(), m_minute_prefix.data(), g_minute_prefix_length) == 0) {
+        if (auto l_suffix = _tryParseTimeSuffix(p_time); l_suffix) {
+            auto l_time = tristan::time::Time::tryCreate(l_suffix->precision,
+                                                         m_hours,
+                                                         m_minutes,
+                                                         l_suffix->seconds,
+                                                         l_suffix->milliseconds,
+                                                         l_suffix->microseconds,
+                                                         l_suffix->nanoseconds);
+            l_time->setOffset(l_suffix->offset);
+            return l_time;
+        }
+        // Rejected suffix is handed over to the full parser so that the error is exactly the same as without the state.
+    }
+    auto l_time = tristan::time::Time::tryParse(p_time);
+    if (l_time) {
+        _rememberMinute(p_time, *l_time);
+    }
+    return l_time;
+}
+
+void tristan::date_time::IncrementalParser::_rememberDate(std::string_view p_date_time, const tristan::date::Date& p_date) noexcept {
+    // Record has been accepted, so delimiter is present and date part is either [YYYYMMDD] or [YYYY-MM-DD].
+    m_date_prefix_length = static_cast< uint8_t >(p_date_time.find('T') + 1);
+    std::memcpy(m_date_prefix.data(), p_date_time.data(), m_date_prefix_length);
+    m_date = p_date;
+    m_days_since_epoch = p_date.daysSinceEpoch();
+}
+
+void tristan::date_time::IncrementalParser::_rememberMinute(std::string_view p_time, const tristan::time::Time& p_parsed_time) noexcept {
+    std::memcpy(m_minute_prefix.data(), p_time.data(), g_minute_prefix_length);
+    m_minute_prefix_set = true;
+    m_hours = p_parsed_time.hours();
+    m_minutes = p_parsed_time.minutes();
+}
@@ -0,0 +1,195 @@
+#include "log_timestamp.hpp"
+#include "calendar_names.hpp"
+#include "rfc3339.hpp"
+#include "detail/digits.hpp"
+
+namespace {
+
+    using tristan::detail::digits;
+
+    inline constexpr size_t g_clf_length = 26;
+    inline constexpr size_t g_rfc_3164_length = 15;
+    inline constexpr size_t g_rfc_5424_max_fraction_digits = 6;
+    // Window of RFC 3164 year inference, see tryParseRfc3164.
+    inline constexpr int64_t g_rfc_3164_days_ahead = 31;
+    inline constexpr int64_t g_rfc_3164_days_behind = 365 - g_rfc_3164_days_ahead;
+
+    /**
+     * \brief Fields of log timestamps. Only offset is validated while decoding.
+     */
+    struct LogFields {
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+        uint8_t hours;
+        uint8_t minutes;
+        uint8_t seconds;
+        int16_t offset_minutes;
+    };
+
+    auto timeDigits(const char* p_text, LogFields& p_fields) -> bool {
+        return p_text[2] == ':' && p_text[5] == ':' && digits(p_text, 2, p_fields.hours) && digits(p_text + 3, 2, p_fields.minutes)
+            && digits(p_text + 6, 2, p_fields.seconds);
+    }
+
+    /**
+     * \brief Decodes [dd/Mon/yyyy:HH:MM:SS +hhmm] with optional square brackets.
+     */
+    auto decodeClf(std::string_view p_timestamp) -> tristan::Result< LogFields > {
+        LogFields l_fields{};
+        if (p_timestamp.size() == g_clf_length + 2 && p_timestamp.front() == '[' && p_timestamp.back() == ']') {
+            p_timestamp = p_timestamp.substr(1, g_clf_length);
+        }
+        if (p_timestamp.size() != g_clf_length) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        const char* l_text = p_timestamp.data();
+        uint8_t l_offset_hours = 0;
+        uint8_t l_offset_minutes = 0;
+        if (l_text[2] != '/' || l_text[6] != '/' || l_text[11] != ':' || l_text[20] != ' ' || (l_text[21] != '+' && l_text[21] != '-')
+            || not digits(l_text, 2, l_fields.day) || not digits(l_text + 7, 4, l_fields.year) || not timeDigits(l_text + 12, l_fields)
+            || not digits(l_text + 22, 2, l_offset_hours) || not digits(l_text + 24, 2, l_offset_minutes)) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        l_fields.month = tristan::date_time::monthFromAbbreviation(l_text + 3);
+        if (l_fields.month == 0) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        if (l_offset_hours > 23 || l_offset_minutes > 59) {
+            return tristan::ErrorCode::OUT_OF_RANGE;
+        }
+        l_fields.offset_minutes = static_cast< int16_t >(l_offset_hours * 60 + l_offset_minutes);
+        if (l_text[21] == '-') {
+            l_fields.offset_minutes = static_cast< int16_t >(-l_fields.offset_minutes);
+        }
+        return l_fields;
+    }
+
+    /**
+     * \brief Decodes [Mon dd HH:MM:SS] and selects the year using reference date.
+     */
+    auto decodeRfc3164(std::string_view p_timestamp, const tristan::date::Date& p_reference) -> tristan::Result< LogFields > {
+        LogFields l_fields{};
+        if (p_timestamp.size() != g_rfc_3164_length) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        const char* l_text = p_timestamp.data();
+        if (l_text[3] != ' ' || l_text[6] != ' ' || not timeDigits(l_text + 7, l_fields)) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        if (l_text[4] == ' ') {
+            if (not digits(l_text + 5, 1, l_fields.day)) {
+                return tristan::ErrorCode::INVALID_FORMAT;
+            }
+        } else if (not digits(l_text + 4, 2, l_fields.day)) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        l_fields.month = tristan::date_time::monthFromAbbreviation(l_text);
+        if (l_fields.month == 0) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        l_fields.offset_minutes = 0;
+        l_fields.year = p_reference.year();
+        auto l_date = tristan::date::Date::tryCreate(l_fields.day, l_fields.month, l_fields.year);
+        if (not l_date) {
+            // February 29 of non leap year is most likely from the previous year.
+            l_fields.year = static_cast< uint16_t >(l_fields.year - 1);
+            return l_fields;
+        }
+        const auto l_distance = l_date->daysSinceEpoch() - p_reference.daysSinceEpoch();
+        if (l_distance > g_rfc_3164_days_ahead) {
+            l_fields.year = static_cast< uint16_t >(l_fields.year - 1);
+        } else if (l_distance < -g_rfc_3164_days_behind) {
+            l_fields.year = static_cast< uint16_t >(l_fields.year + 1);
+        }
+        return l_fields;
+    }
+
+    auto makeDateTime(const LogFields& p_fields) -> tristan::Result< tristan::date_time::DateTime > {
+        auto l_date = tristan::date::Date::tryCreate(p_fields.day, p_fields.month, p_fields.year);
+        if (not l_date) {
+            return l_date.error();
+        }
+        auto l_time = tristan::time::Time::tryCreate(tristan::time::Precision::SECONDS, p_fields.hours, p_fields.minutes, p_fields.seconds);
+        if (not l_time) {
+            return l_time.error();
+        }
+        return tristan::date_time::DateTime::fromLocal(std::move(l_date).value(), std::move(l_time).value(), std::chrono::minutes{p_fields.offset_minutes});
+    }
+
+    auto makeSinceEpoch(const LogFields& p_fields) -> tristan::Result< std::chrono::nanoseconds > {
+        auto l_date = tristan::date::Date::tryCreate(p_fields.day, p_fields.month, p_fields.year);
+        if (not l_date) {
+            return l_date.error();
+        }
+        // Same limits as in Time::tryCreate.
+        if (p_fields.hours > 23 || p_fields.minutes > 59 || p_fields.seconds > 59) {
+            return tristan::ErrorCode::OUT_OF_RANGE;
+        }
+        return std::chrono::nanoseconds(tristan::date::Days{l_date->daysSinceEpoch()} + std::chrono::hours{p_fields.hours}
+                                        + std::chrono::minutes{p_fields.minutes - p_fields.offset_minutes} + std::chrono::seconds{p_fields.seconds});
+    }
+
+    auto isRfc5424(std::string_view p_timestamp) -> bool {
+        if (p_timestamp.size() < 20 || p_timestamp[10] != 'T' || p_timestamp.back() == 'z') {
+            return false;
+        }
+        if (p_timestamp[19] != '.') {
+            return true;
+        }
+        size_t l_digits = 0;
+        while (20 + l_digits < p_timestamp.size() && p_timestamp[20 + l_digits] >= '0' && p_timestamp[20 + l_digits] <= '9') {
+            ++l_digits;
+        }
+        return l_digits <= g_rfc_5424_max_fraction_digits;
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::tryParseClf(std::string_view p_timestamp) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    auto l_fields = decodeClf(p_timestamp);
+    if (not l_fields) {
+        return l_fields.error();
+    }
+    return makeDateTime(*l_fields);
+}
+
+auto tristan::date_time::tryParseClfSinceEpoch(std::string_view p_timestamp) noexcept -> tristan::Result< std::chrono::nanoseconds > {
+    auto l_fields = decodeClf(p_timestamp);
+    if (not l_fields) {
+        return l_fields.error();
+    }
+    return makeSinceEpoch(*l_fields);
+}
+
+auto tristan::date_time::tryParseRfc3164(std::string_view p_timestamp, const tristan::date::Date& p_reference) noexcept
+    -> tristan::Result< tristan::date_time::DateTime > {
+    auto l_fields = decodeRfc3164(p_timestamp, p_reference);
+    if (not l_fields) {
+        return l_fields.error();
+    }
+    return makeDateTime(*l_fields);
+}
+
+auto tristan::date_time::tryParseRfc3164SinceEpoch(std::string_view p_timestamp, const tristan::date::Date& p_reference) noexcept
+    -> tristan::Result< std::chrono::nanoseconds > {
+    auto l_fields = decodeRfc3164(p_timestamp, p_reference);
+    if (not l_fields) {
+        return l_fields.error();
+    }
+    return makeSinceEpoch(*l_fields);
+}
+
+auto tristan::date_time::tryParseRfc5424(std::string_view p_timestamp) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    if (not isRfc5424(p_timestamp)) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    return tristan::date_time::tryParseRfc3339(p_timestamp);
+}
+
+auto tristan::date_time::tryParseRfc5424SinceEpoch(std::string_view p_timestamp) noexcept -> tristan::Result< std::chrono::nanoseconds > {
+    auto l_date_time = tryParseRfc5424(p_timestamp);
+    if (not l_date_time) {
+        return l_date_time.error();
+    }
+    return l_date_time->sinceEpoch();
+}
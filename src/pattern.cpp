@@ -0,0 +1,130 @@
+#include "pattern.hpp"
+#include "detail/digits.hpp"
+
+namespace {
+
+    using tristan::detail::g_powers_of_ten;
+    using tristan::detail::isDigit;
+
+}  //End of unnamed namespace
+
+auto tristan::date_time::Pattern::tryParse(std::string_view p_date_time) const noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    Fields l_fields{};
+    if (not _decode(p_date_time, l_fields)) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    if (l_fields.offset < static_cast< int8_t >(tristan::TimeZone::WEST_12) || l_fields.offset > static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    auto l_date = tristan::date::Date::tryCreate(l_fields.day, l_fields.month, l_fields.year);
+    if (not l_date) {
+        return l_date.error();
+    }
+    auto l_time = tristan::time::Time::tryCreate(m_precision,
+                                                 l_fields.hours,
+                                                 l_fields.minutes,
+                                                 l_fields.seconds,
+                                                 static_cast< uint16_t >(l_fields.fraction_nanoseconds / 1000000),
+                                                 static_cast< uint16_t >(l_fields.fraction_nanoseconds / 1000 % 1000),
+                                                 static_cast< uint16_t >(l_fields.fraction_nanoseconds % 1000));
+    if (not l_time) {
+        return l_time.error();
+    }
+    l_time->setOffset(static_cast< tristan::TimeZone >(l_fields.offset));
+    return tristan::date_time::DateTime(std::move(l_date).value(), std::move(l_time).value());
+}
+
+auto tristan::date_time::Pattern::parse(std::string_view p_date_time) const -> tristan::date_time::DateTime {
+    return tryParse(p_date_time).valueOrThrow("tristan::date_time::Pattern::parse(std::string_view p_date_time)");
+}
+
+auto tristan::date_time::Pattern::tryParseSinceEpoch(std::string_view p_date_time) const noexcept -> tristan::Result< std::chrono::nanoseconds > {
+    Fields l_fields{};
+    if (not _decode(p_date_time, l_fields)) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    if (l_fields.offset < static_cast< int8_t >(tristan::TimeZone::WEST_12) || l_fields.offset > static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    auto l_date = tristan::date::Date::tryCreate(l_fields.day, l_fields.month, l_fields.year);
+    if (not l_date) {
+        return l_date.error();
+    }
+    // Same limits as in Time::tryCreate. Fraction can not exceed 999999999 as it has at most 9 digits.
+    if (l_fields.hours > 23 || l_fields.minutes > 59 || l_fields.seconds > 59) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    return std::chrono::nanoseconds(tristan::date::Days{l_date->daysSinceEpoch()} + std::chrono::hours{l_fields.hours}
+                                    + std::chrono::minutes{l_fields.minutes} + std::chrono::seconds{l_fields.seconds}
+                                    + std::chrono::nanoseconds{l_fields.fraction_nanoseconds} - std::chrono::hours{l_fields.offset});
+}
+
+auto tristan::date_time::Pattern::_decode(std::string_view p_date_time, Fields& p_fields) const noexcept -> bool {
+    if (p_date_time.size() != m_length) {
+        return false;
+    }
+    const char* l_char = p_date_time.data();
+    for (uint8_t l_index = 0; l_index < m_steps_count; ++l_index) {
+        const auto& l_step = m_steps[l_index];
+        if (l_step.field == Field::LITERAL) {
+            if (*l_char++ != l_step.literal) {
+                return false;
+            }
+            continue;
+        }
+        bool l_negative = false;
+        uint8_t l_width = l_step.width;
+        if (l_step.field == Field::OFFSET) {
+            if (*l_char != '+' && *l_char != '-') {
+                return false;
+            }
+            l_negative = *l_char++ == '-';
+            l_width = 2;
+        }
+        uint32_t l_value = 0;
+        for (uint8_t l_digit = 0; l_digit < l_width; ++l_digit, ++l_char) {
+            if (not isDigit(*l_char)) {
+                return false;
+            }
+            l_value = l_value * 10 + static_cast< uint32_t >(*l_char - '0');
+        }
+        switch (l_step.field) {
+            case Field::YEAR: {
+                p_fields.year = static_cast< uint16_t >(l_value);
+                break;
+            }
+            case Field::MONTH: {
+                p_fields.month = static_cast< uint8_t >(l_value);
+                break;
+            }
+            case Field::DAY: {
+                p_fields.day = static_cast< uint8_t >(l_value);
+                break;
+            }
+            case Field::HOURS: {
+                p_fields.hours = static_cast< uint8_t >(l_value);
+                break;
+            }
+            case Field::MINUTES: {
+                p_fields.minutes = static_cast< uint8_t >(l_value);
+                break;
+            }
+            case Field::SECONDS: {
+                p_fields.seconds = static_cast< uint8_t >(l_value);
+                break;
+            }
+            case Field::FRACTION: {
+                p_fields.fraction_nanoseconds = static_cast< uint32_t >(l_value * g_powers_of_ten[9 - l_width]);
+                break;
+            }
+            case Field::OFFSET: {
+                p_fields.offset = static_cast< int8_t >(l_negative ? -static_cast< int8_t >(l_value) : static_cast< int8_t >(l_value));
+                break;
+            }
+            case Field::LITERAL: {
+                break;
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,182 @@
+#include "rfc3339.hpp"
+#include "detail/digits.hpp"
+
+#include <array>
+
+namespace {
+
+    using tristan::detail::g_powers_of_ten;
+    using tristan::detail::isDigit;
+    using tristan::detail::digits;
+    using tristan::detail::precisionFromFractionDigits;
+    using tristan::detail::writeTwoDigits;
+
+    inline constexpr size_t g_date_length = 10;
+    inline constexpr size_t g_max_fraction_digits = 9;
+
+    /**
+     * \brief Fields of RFC 3339 time. Ranges of hours, minutes and seconds are not validated.
+     */
+    struct TimeFields {
+        uint8_t hours;
+        uint8_t minutes;
+        uint8_t seconds;
+        uint32_t fraction_nanoseconds;
+        tristan::time::Precision precision;
+        int16_t offset_minutes;
+    };
+
+    /**
+     * \brief Decodes [HH:MM:SS[.f](Z|+HH:MM|-HH:MM)] which has to span the whole range.
+     */
+    auto decodeTime(const char* p_first, const char* p_last) -> tristan::Result< TimeFields > {
+        TimeFields l_fields{};
+        if (p_last - p_first < 9 || p_first[2] != ':' || p_first[5] != ':' || not digits(p_first, 2, l_fields.hours)
+            || not digits(p_first + 3, 2, l_fields.minutes) || not digits(p_first + 6, 2, l_fields.seconds)) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        p_first += 8;
+        if (*p_first == '.') {
+            const char* l_fraction = ++p_first;
+            uint32_t l_value = 0;
+            while (p_first != p_last && isDigit(*p_first) && p_first - l_fraction < static_cast< ptrdiff_t >(g_max_fraction_digits)) {
+                l_value = l_value * 10 + static_cast< uint32_t >(*p_first++ - '0');
+            }
+            const auto l_digits = static_cast< size_t >(p_first - l_fraction);
+            if (l_digits == 0) {
+                return tristan::ErrorCode::INVALID_FORMAT;
+            }
+            l_fields.fraction_nanoseconds = static_cast< uint32_t >(l_value * g_powers_of_ten[g_max_fraction_digits - l_digits]);
+            l_fields.precision = precisionFromFractionDigits(l_digits);
+        } else {
+            l_fields.precision = tristan::time::Precision::SECONDS;
+        }
+        if (p_first == p_last) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        if (*p_first == 'Z' || *p_first == 'z') {
+            if (p_first + 1 != p_last) {
+                return tristan::ErrorCode::INVALID_FORMAT;
+            }
+            l_fields.offset_minutes = 0;
+            return l_fields;
+        }
+        uint8_t l_hours = 0;
+        uint8_t l_minutes = 0;
+        if ((*p_first != '+' && *p_first != '-') || p_last - p_first != 6 || p_first[3] != ':' || not digits(p_first + 1, 2, l_hours)
+            || not digits(p_first + 4, 2, l_minutes)) {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        if (l_hours > 23 || l_minutes > 59) {
+            return tristan::ErrorCode::OUT_OF_RANGE;
+        }
+        l_fields.offset_minutes = static_cast< int16_t >(l_hours * 60 + l_minutes);
+        if (*p_first == '-') {
+            l_fields.offset_minutes = static_cast< int16_t >(-l_fields.offset_minutes);
+        }
+        return l_fields;
+    }
+
+    auto makeTime(const TimeFields& p_fields) -> tristan::Result< tristan::time::Time > {
+        return tristan::time::Time::tryCreate(p_fields.precision,
+                                              p_fields.hours,
+                                              p_fields.minutes,
+                                              p_fields.seconds,
+                                              static_cast< uint16_t >(p_fields.fraction_nanoseconds / 1000000),
+                                              static_cast< uint16_t >(p_fields.fraction_nanoseconds / 1000 % 1000),
+                                              static_cast< uint16_t >(p_fields.fraction_nanoseconds % 1000));
+    }
+
+    /**
+     * \brief Writes [HH:MM:SS[.f](Z|+HH:MM|-HH:MM)].
+     * \return Pointer past the last written character.
+     */
+    auto writeTime(const tristan::time::Time& p_time, char* p_buffer) -> char* {
+        writeTwoDigits(p_buffer, p_time.hours());
+        p_buffer[2] = ':';
+        writeTwoDigits(p_buffer + 3, p_time.minutes());
+        p_buffer[5] = ':';
+        writeTwoDigits(p_buffer + 6, p_time.seconds());
+        p_buffer += 8;
+        if (p_time.precision() > tristan::time::Precision::SECONDS) {
+            const auto l_digits = static_cast< size_t >(static_cast< uint8_t >(p_time.precision()) - 1) * 3;
+            auto l_fraction = static_cast< uint32_t >((p_time.sinceDayStart() % std::chrono::seconds(1)).count()
+                                                      / g_powers_of_ten[g_max_fraction_digits - l_digits]);
+            *p_buffer = '.';
+            for (size_t l_index = l_digits; l_index > 0; --l_index) {
+                p_buffer[l_index] = static_cast< char >('0' + l_fraction % 10);
+                l_fraction /= 10;
+            }
+            p_buffer += l_digits + 1;
+        }
+        const auto l_offset = static_cast< int8_t >(p_time.offset());
+        if (l_offset == 0) {
+            *p_buffer++ = 'Z';
+            return p_buffer;
+        }
+        p_buffer[0] = l_offset < 0 ? '-' : '+';
+        writeTwoDigits(p_buffer + 1, static_cast< uint32_t >(l_offset < 0 ? -l_offset : l_offset));
+        p_buffer[3] = ':';
+        p_buffer[4] = '0';
+        p_buffer[5] = '0';
+        return p_buffer + 6;
+    }
+}  //End of unnamed namespace
+
+auto tristan::date_time::tryParseRfc3339(std::string_view p_date_time) noexcept -> tristan::Result< tristan::date_time::DateTime > {
+    const char* l_text = p_date_time.data();
+    uint16_t l_year = 0;
+    uint8_t l_month = 0;
+    uint8_t l_day = 0;
+    if (p_date_time.size() <= g_date_length || l_text[4] != '-' || l_text[7] != '-' || (l_text[10] != 'T' && l_text[10] != 't')
+        || not digits(l_text, 4, l_year) || not digits(l_text + 5, 2, l_month) || not digits(l_text + 8, 2, l_day)) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+    auto l_fields = decodeTime(l_text + g_date_length + 1, l_text + p_date_time.size());
+    if (not l_fields) {
+        return l_fields.error();
+    }
+    auto l_date = tristan::date::Date::tryCreate(l_day, l_month, l_year);
+    if (not l_date) {
+        return l_date.error();
+    }
+    auto l_time = makeTime(*l_fields);
+    if (not l_time) {
+        return l_time.error();
+    }
+    return tristan::date_time::DateTime::fromLocal(std::move(l_date).value(), std::move(l_time).value(), std::chrono::minutes{l_fields->offset_minutes});
+}
+
+auto tristan::date_time::tryParseRfc3339Time(std::string_view p_time) noexcept -> tristan::Result< tristan::time::Time > {
+    auto l_fields = decodeTime(p_time.data(), p_time.data() + p_time.size());
+    if (not l_fields) {
+        return l_fields.error();
+    }
+    if (l_fields->offset_minutes % 60 != 0 || l_fields->offset_minutes / 60 < static_cast< int8_t >(tristan::TimeZone::WEST_12)
+        || l_fields->offset_minutes / 60 > static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    auto l_time = makeTime(*l_fields);
+    if (l_time) {
+        l_time->setOffset(static_cast< tristan::TimeZone >(l_fields->offset_minutes / 60));
+    }
+    return l_time;
+}
+
+auto tristan::date_time::writeRfc3339(const tristan::date_time::DateTime& p_date_time, std::span< char, g_rfc3339_max_length > p_buffer) -> size_t {
+    char* l_buffer = p_buffer.data();
+    p_date_time.date().toChars(l_buffer, l_buffer + g_date_length);
+    l_buffer[10] = 'T';
+    return static_cast< size_t >(writeTime(p_date_time.time(), l_buffer + g_date_length + 1) - l_buffer);
+}
+
+auto tristan::date_time::toRfc3339(const tristan::date_time::DateTime& p_date_time) -> std::string {
+    std::array< char, g_rfc3339_max_length > l_buffer;
+    const auto l_length = writeRfc3339(p_date_time, l_buffer);
+    return {l_buffer.data(), l_length};
+}
+
+auto tristan::date_time::toRfc3339(const tristan::time::Time& p_time) -> std::string {
+    std::array< char, g_rfc3339_max_length > l_buffer;
+    return {l_buffer.data(), static_cast< size_t >(writeTime(p_time, l_buffer.data()) - l_buffer.data())};
+}
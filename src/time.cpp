@@ -1,9 +1,13 @@
 #include "time.hpp"
+#include "detail/digits.hpp"
+#include "detail/extract.hpp"
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <charconv>
 
 namespace {
-    auto checkTimeFormat(const std::string& time) -> bool;
+    auto checkTimeFormat(std::string_view time) -> bool;
     constexpr uint64_t microseconds_in_day = 86400000000;
     constexpr uint64_t nanoseconds_in_day = 86400000000000;
     constexpr uint64_t nanoseconds_in_hour = 3600000000000;
@@ -26,75 +30,13 @@ namespace {
     constexpr uint8_t g_seconds_in_minute = 60;
     using Days = std::chrono::duration< int64_t, std::ratio_divide< std::ratio< seconds_in_day >, std::chrono::seconds::period > >;
 
+    using tristan::detail::fromDigits;
+    using tristan::detail::writeThreeDigits;
+    using tristan::detail::writeTwoDigits;
+
     auto g_default_global_formatter = [](const tristan::time::Time& p_time) -> std::string {
         std::string l_time;
-
-        auto hours = p_time.hours();
-        if (hours < 10) {
-            l_time += '0';
-        }
-        l_time += std::to_string(hours);
-        l_time += ':';
-        auto minutes = p_time.minutes();
-        if (minutes < 10) {
-            l_time += '0';
-        }
-        l_time += std::to_string(minutes);
-
-        if (p_time.precision() >= tristan::time::Precision::SECONDS) {
-            l_time += ':';
-            auto seconds = p_time.seconds();
-            if (seconds < 10) {
-                l_time += '0';
-            }
-            l_time += std::to_string(seconds);
-        }
-
-        if (p_time.precision() >= tristan::time::Precision::MILLISECONDS) {
-            l_time += '.';
-            auto milliseconds = p_time.milliseconds();
-            if (milliseconds < 100) {
-                l_time += '0';
-            }
-            if (milliseconds < 10) {
-                l_time += '0';
-            }
-            l_time += std::to_string(milliseconds);
-        }
-
-        if (p_time.precision() >= tristan::time::Precision::MICROSECONDS) {
-            l_time += '.';
-            auto microseconds = p_time.microseconds();
-            if (microseconds < 100) {
-                l_time += '0';
-            }
-            if (microseconds < 10) {
-                l_time += '0';
-            }
-            l_time += std::to_string(microseconds);
-        }
-
-        if (p_time.precision() == tristan::time::Precision::NANOSECONDS) {
-            l_time += '.';
-            auto nanoseconds = p_time.nanoseconds();
-            if (nanoseconds < 100) {
-                l_time += '0';
-            }
-            if (nanoseconds < 10) {
-                l_time += '0';
-            }
-            l_time += std::to_string(nanoseconds);
-        }
-        if (p_time.offset() >= tristan::TimeZone::UTC) {
-            l_time += '+';
-            if (p_time.offset() < tristan::TimeZone::EAST_10) {
-                l_time += '0';
-            }
-        }
-        l_time += std::to_string(static_cast< int8_t >(p_time.offset()));
-        if (p_time.offset() > tristan::TimeZone::WEST_10 && p_time.offset() < tristan::TimeZone::UTC) {
-            l_time += '0';
-        }
+        p_time.appendTo(l_time);
         return l_time;
     };
 
@@ -246,82 +188,42 @@ tristan::time::Time::Time(uint8_t hours, uint8_t minutes, uint8_t seconds, uint1
     m_precision = tristan::time::Precision::NANOSECONDS;
 }
 
-tristan::time::Time::Time(const std::string& time) :
-    m_offset{tristan::TimeZone::UTC},
-    m_precision(tristan::time::Precision::MINUTES) {
-
-    auto l_time = time;
-
-    auto offset_pos = l_time.find_first_of("-+");
-    auto offset = tristan::TimeZone::UTC;
-    if (offset_pos != std::string::npos && offset_pos == l_time.size() - 3) {
-        offset = static_cast< tristan::TimeZone >(std::stoi(l_time.substr(offset_pos)));
-        l_time.erase(offset_pos);
-    }
-    if (!checkTimeFormat(l_time)) {
-        throw std::invalid_argument{"tristan::time::Time::Time(const std::string& "
-                                    "time): Invalid time format"};
-    }
-    auto size = l_time.length();
-
-    const uint8_t hours_pos = 0;
-    const uint8_t minutes_pos = 3;
-    const uint8_t seconds_pos = 6;
-    const uint8_t milliseconds_pos = 9;
-    const uint8_t microseconds_pos = 13;
-    const uint8_t nanoseconds_pos = 17;
+tristan::time::Time::Time(std::string_view p_time) :
+    tristan::time::Time(tryParse(p_time).valueOrThrow("tristan::time::Time::Time(std::string_view p_time)")) { }
 
-    switch (size) {
-        case 5: {
-            auto hours = std::stoi(l_time.substr(hours_pos, 2));
-            auto minutes = std::stoi(l_time.substr(minutes_pos, 2));
-            *this = tristan::time::Time(hours, minutes);
+tristan::time::Time::Time(std::chrono::nanoseconds p_time_since_day_start, tristan::time::Precision p_precision, tristan::TimeZone p_offset) noexcept :
+    m_offset(p_offset),
+    m_precision(p_precision) {
+    switch (m_precision) {
+        case tristan::time::Precision::MINUTES: {
+            m_time_since_day_start = std::chrono::duration_cast< std::chrono::minutes >(p_time_since_day_start);
             break;
         }
-        case 8: {
-            auto hours = std::stoi(l_time.substr(hours_pos, 2));
-            auto minutes = std::stoi(l_time.substr(minutes_pos, 2));
-            auto seconds = std::stoi(l_time.substr(seconds_pos, 2));
-            *this = tristan::time::Time(hours, minutes, seconds);
+        case tristan::time::Precision::SECONDS: {
+            m_time_since_day_start = std::chrono::duration_cast< std::chrono::seconds >(p_time_since_day_start);
             break;
         }
-        case 12: {
-            auto hours = std::stoi(l_time.substr(hours_pos, 2));
-            auto minutes = std::stoi(l_time.substr(minutes_pos, 2));
-            auto seconds = std::stoi(l_time.substr(seconds_pos, 2));
-            auto milliseconds = std::stoi(l_time.substr(milliseconds_pos, 3));
-            *this = tristan::time::Time(hours, minutes, seconds, milliseconds);
+        case tristan::time::Precision::MILLISECONDS: {
+            m_time_since_day_start = std::chrono::duration_cast< std::chrono::milliseconds >(p_time_since_day_start);
             break;
         }
-        case 16: {
-            auto hours = std::stoi(l_time.substr(hours_pos, 2));
-            auto minutes = std::stoi(l_time.substr(minutes_pos, 2));
-            auto seconds = std::stoi(l_time.substr(seconds_pos, 2));
-            auto milliseconds = std::stoi(l_time.substr(milliseconds_pos, 3));
-            auto microseconds = std::stoi(l_time.substr(microseconds_pos, 3));
-            *this = tristan::time::Time(hours, minutes, seconds, milliseconds, microseconds);
+        case tristan::time::Precision::MICROSECONDS: {
+            m_time_since_day_start = std::chrono::duration_cast< std::chrono::microseconds >(p_time_since_day_start);
             break;
         }
-        case 20: {
-            auto hours = std::stoi(l_time.substr(hours_pos, 2));
-            auto minutes = std::stoi(l_time.substr(minutes_pos, 2));
-            auto seconds = std::stoi(l_time.substr(seconds_pos, 2));
-            auto milliseconds = std::stoi(l_time.substr(milliseconds_pos, 3));
-            auto microseconds = std::stoi(l_time.substr(microseconds_pos, 3));
-            auto nanoseconds = std::stoi(l_time.substr(nanoseconds_pos, 3));
-            *this = tristan::time::Time(hours, minutes, seconds, milliseconds, microseconds, nanoseconds);
+        case tristan::time::Precision::NANOSECONDS: {
+            m_time_since_day_start = p_time_since_day_start;
             break;
         }
-        default: {
-            throw std::invalid_argument{"tristan::time::Time::Time(const std::string& "
-                                        "time): Invalid time format"};
-        }
-    }
-    if (m_offset != offset) {
-        m_offset = offset;
     }
 }
 
+void tristan::time::Time::_assignValue(const tristan::time::Time& p_other) noexcept {
+    m_time_since_day_start = p_other.m_time_since_day_start;
+    m_offset = p_other.m_offset;
+    m_precision = p_other.m_precision;
+}
+
 auto tristan::time::Time::operator==(const tristan::time::Time& other) const -> bool {
 
     if (m_precision != other.m_precision) {
@@ -847,6 +749,14 @@ auto tristan::time::Time::nanoseconds() const -> uint16_t {
         this->m_time_since_day_start);
 }
 
+auto tristan::time::Time::sinceDayStart() const -> std::chrono::nanoseconds {
+    return std::visit(
+        [](const auto& value) {
+            return std::chrono::duration_cast< std::chrono::nanoseconds >(value);
+        },
+        this->m_time_since_day_start);
+}
+
 auto tristan::time::Time::localTime(Precision p_precision) -> tristan::time::Time {
 
     auto tm = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
@@ -855,18 +765,157 @@ auto tristan::time::Time::localTime(Precision p_precision) -> tristan::time::Tim
     return tristan::time::Time(static_cast< tristan::TimeZone >(offset / 3600), p_precision);
 }
 
-void tristan::time::Time::setGlobalFormatter(tristan::time::Formatter&& p_formatter) { m_formatter_global = std::move(p_formatter); }
+auto tristan::time::Time::tryParse(std::string_view p_time) noexcept -> tristan::Result< tristan::time::Time > {
+    auto offset = tristan::TimeZone::UTC;
+    auto size = p_time.length();
+    if (size > 3 && (p_time[size - 3] == '+' || p_time[size - 3] == '-')) {
+        if (p_time[size - 2] < '0' || p_time[size - 2] > '9' || p_time[size - 1] < '0' || p_time[size - 1] > '9') {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+        auto offset_hours = fromDigits< int8_t >(p_time.data() + size - 2, 2);
+        if (offset_hours > static_cast< int8_t >(tristan::TimeZone::EAST_12)) {
+            return tristan::ErrorCode::OUT_OF_RANGE;
+        }
+        offset = static_cast< tristan::TimeZone >(p_time[size - 3] == '-' ? -offset_hours : offset_hours);
+        p_time.remove_suffix(3);
+        size -= 3;
+    }
+    if (!checkTimeFormat(p_time)) {
+        return tristan::ErrorCode::INVALID_FORMAT;
+    }
+
+    const uint8_t hours_pos = 0;
+    const uint8_t minutes_pos = 3;
+    const uint8_t seconds_pos = 6;
+    const uint8_t milliseconds_pos = 9;
+    const uint8_t microseconds_pos = 13;
+    const uint8_t nanoseconds_pos = 17;
+
+    tristan::time::Precision precision;
+    switch (size) {
+        case 5: {
+            precision = tristan::time::Precision::MINUTES;
+            break;
+        }
+        case 8: {
+            precision = tristan::time::Precision::SECONDS;
+            break;
+        }
+        case 12: {
+            precision = tristan::time::Precision::MILLISECONDS;
+            break;
+        }
+        case 16: {
+            precision = tristan::time::Precision::MICROSECONDS;
+            break;
+        }
+        case 20: {
+            precision = tristan::time::Precision::NANOSECONDS;
+            break;
+        }
+        default: {
+            return tristan::ErrorCode::INVALID_FORMAT;
+        }
+    }
+    auto hours = fromDigits< uint8_t >(p_time.data() + hours_pos, 2);
+    auto minutes = fromDigits< uint8_t >(p_time.data() + minutes_pos, 2);
+    auto seconds = precision >= tristan::time::Precision::SECONDS ? fromDigits< uint8_t >(p_time.data() + seconds_pos, 2) : uint8_t{0};
+    auto milliseconds = precision >= tristan::time::Precision::MILLISECONDS ? fromDigits< uint16_t >(p_time.data() + milliseconds_pos, 3) : uint16_t{0};
+    auto microseconds = precision >= tristan::time::Precision::MICROSECONDS ? fromDigits< uint16_t >(p_time.data() + microseconds_pos, 3) : uint16_t{0};
+    auto nanoseconds = precision == tristan::time::Precision::NANOSECONDS ? fromDigits< uint16_t >(p_time.data() + nanoseconds_pos, 3) : uint16_t{0};
+
+    auto result = tristan::time::Time::tryCreate(precision, hours, minutes, seconds, milliseconds, microseconds, nanoseconds);
+    if (result) {
+        result->m_offset = offset;
+    }
+    return result;
+}
+
+auto tristan::time::Time::tryCreate(tristan::time::Precision p_precision,
+                                    uint8_t p_hours,
+                                    uint8_t p_minutes,
+                                    uint8_t p_seconds,
+                                    uint16_t p_milliseconds,
+                                    uint16_t p_microseconds,
+                                    uint16_t p_nanoseconds) noexcept -> tristan::Result< tristan::time::Time > {
+    if (p_hours > 23 || p_minutes > 59 || p_seconds > 59 || p_milliseconds > 999 || p_microseconds > 999 || p_nanoseconds > 999) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    auto time_since_day_start = std::chrono::hours(p_hours) + std::chrono::minutes(p_minutes) + std::chrono::seconds(p_seconds)
+                              + std::chrono::milliseconds(p_milliseconds) + std::chrono::microseconds(p_microseconds)
+                              + std::chrono::nanoseconds(p_nanoseconds);
+    return tristan::time::Time(time_since_day_start, p_precision, tristan::TimeZone::UTC);
+}
+
+auto tristan::time::Time::fromSinceDayStart(std::chrono::nanoseconds p_since_day_start,
+                                            tristan::time::Precision p_precision,
+                                            tristan::TimeZone p_offset) noexcept -> tristan::Result< tristan::time::Time > {
+    if (p_since_day_start.count() < 0 || p_since_day_start.count() >= static_cast< int64_t >(nanoseconds_in_day)) {
+        return tristan::ErrorCode::OUT_OF_RANGE;
+    }
+    return tristan::time::Time(p_since_day_start, p_precision, p_offset);
+}
+
+void tristan::time::Time::setGlobalFormatter(tristan::time::Formatter&& p_formatter) { m_formatter_global.set(std::move(p_formatter)); }
 
 void tristan::time::Time::setLocalFormatter(tristan::time::Formatter&& p_formatter) { m_formatter_local = std::move(p_formatter); }
 
+auto tristan::time::Time::usesDefaultFormatter() const -> bool {
+    return not m_formatter_local && not m_formatter_global.installed();
+}
+
 std::string tristan::time::Time::toString() const {
-    if (not m_formatter_global) {
-        tristan::time::Time::m_formatter_global = g_default_global_formatter;
-    }
     if (m_formatter_local) {
         return m_formatter_local(*this);
     }
-    return m_formatter_global(*this);
+    if (const auto l_formatter = m_formatter_global.get(); l_formatter) {
+        return (*l_formatter)(*this);
+    }
+    return g_default_global_formatter(*this);
+}
+
+auto tristan::time::Time::toChars(char* p_first, char* p_last) const noexcept -> std::to_chars_result {
+    const auto l_groups = static_cast< size_t >(m_precision);
+    // [HH:MM] and [+HH], [:SS] starting from seconds precision and [.nnn] for every precision step after seconds.
+    const size_t l_length = 8 + (l_groups > 0 ? 3 : 0) + (l_groups > 1 ? (l_groups - 1) * 4 : 0);
+    if (p_last - p_first < static_cast< std::ptrdiff_t >(l_length)) {
+        return {p_last, std::errc::value_too_large};
+    }
+    const auto l_since_day_start = static_cast< uint64_t >(sinceDayStart().count());
+    const auto l_seconds = static_cast< uint32_t >(l_since_day_start / nanoseconds_in_second);
+    const auto l_fraction = static_cast< uint32_t >(l_since_day_start % nanoseconds_in_second);
+    writeTwoDigits(p_first, l_seconds / g_seconds_in_hour);
+    p_first[2] = ':';
+    writeTwoDigits(p_first + 3, l_seconds / g_seconds_in_minute % g_minutes_in_hour);
+    char* l_end = p_first + 5;
+    if (m_precision >= tristan::time::Precision::SECONDS) {
+        l_end[0] = ':';
+        writeTwoDigits(l_end + 1, l_seconds % g_seconds_in_minute);
+        l_end += 3;
+    }
+    auto l_divisor = static_cast< uint32_t >(nanoseconds_in_millisecond);
+    for (size_t l_group = 1; l_group < l_groups; ++l_group, l_divisor /= 1000) {
+        l_end[0] = '.';
+        writeThreeDigits(l_end + 1, l_fraction / l_divisor % 1000);
+        l_end += 4;
+    }
+    const auto l_offset = static_cast< int8_t >(m_offset);
+    l_end[0] = l_offset < 0 ? '-' : '+';
+    writeTwoDigits(l_end + 1, static_cast< uint32_t >(l_offset < 0 ? -l_offset : l_offset));
+    return {l_end + 3, std::errc{}};
+}
+
+void tristan::time::Time::appendTo(std::string& p_string) const {
+    std::array< char, tristan::time::g_time_max_length > l_buffer;
+    const auto l_result = toChars(l_buffer.data(), l_buffer.data() + l_buffer.size());
+    p_string.append(l_buffer.data(), l_result.ptr);
+}
+
+auto tristan::time::Time::toFixedString() const noexcept -> tristan::FixedString< tristan::time::g_time_max_length > {
+    tristan::FixedString< tristan::time::g_time_max_length > l_string;
+    const auto l_result = toChars(l_string.data(), l_string.data() + l_string.capacity());
+    l_string.resize(static_cast< size_t >(l_result.ptr - l_string.data()));
+    return l_string;
 }
 
 bool tristan::time::operator!=(const tristan::time::Time& l, const tristan::time::Time& r) { return !(l == r); }
@@ -878,7 +927,12 @@ bool tristan::time::operator<=(const tristan::time::Time& l, const tristan::time
 bool tristan::time::operator>=(const tristan::time::Time& l, const tristan::time::Time& r) { return (l > r || l == r); }
 
 std::ostream& tristan::time::operator<<(std::ostream& out, const tristan::time::Time& time) {
-    out << time.toString();
+    if (not time.usesDefaultFormatter()) {
+        out << time.toString();
+        return out;
+    }
+    const auto l_text = time.toFixedString();
+    out << l_text.view();
     return out;
 }
 
@@ -1021,7 +1075,7 @@ void tristan::time::Time::_subtractNanoseconds(uint64_t nanoseconds) {
 }
 
 namespace {
-    auto checkTimeFormat(const std::string& time) -> bool {
+    auto checkTimeFormat(std::string_view time) -> bool {
 
         auto length = time.length();
         if (length < 5 || length > 20) {
@@ -1067,4 +1121,17 @@ namespace {
         }
         return true;
     }
-}  // End of unnamed namespace
\ No newline at end of file
+}  // End of unnamed namespace
+
+auto tristan::time::operator>>(std::istream& in, tristan::time::Time& time) -> std::istream& {
+    tristan::detail::LayoutMatcher l_matcher(tristan::detail::g_time_table);
+    return tristan::detail::extract< tristan::time::g_time_max_length >(
+        in, [&l_matcher](char p_char) { return l_matcher.extend(p_char); }, [&time](std::string_view p_text) {
+            auto l_result = tristan::time::Time::tryParse(p_text);
+            if (not l_result) {
+                return false;
+            }
+            time._assignValue(*l_result);
+            return true;
+        });
+}
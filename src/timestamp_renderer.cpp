@@ -0,0 +1,76 @@
+#include "timestamp_renderer.hpp"
+
+namespace {
+
+    // Background thread spins with yield for a while after the ring became empty and then sleeps, so that idle renderer does not occupy a core.
+    inline constexpr size_t g_idle_spins = 64;
+    inline constexpr std::chrono::microseconds g_idle_sleep{50};
+}  //End of unnamed namespace
+
+tristan::date_time::TimestampRenderer::TimestampRenderer(Sink p_sink, tristan::date_time::FormatSpec p_spec, tristan::TimeZone p_offset) :
+    m_sink(std::move(p_sink)),
+    m_spec(p_spec),
+    m_offset(p_offset),
+    m_stopping(false),
+    m_records{},
+    m_tags(max_batch_size),
+    m_offsets(max_batch_size + 1),
+    m_text(max_batch_size * tristan::date_time::FormatSpec::max_length) {
+    if (not m_sink) {
+        throw std::invalid_argument("tristan::date_time::TimestampRenderer: Sink is empty");
+    }
+    m_worker = std::thread(&TimestampRenderer::_run, this);
+}
+
+tristan::date_time::TimestampRenderer::~TimestampRenderer() { stop(); }
+
+void tristan::date_time::TimestampRenderer::stop() {
+    m_stopping.store(true, std::memory_order_release);
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+void tristan::date_time::TimestampRenderer::_run() {
+    size_t l_idle = 0;
+    while (true) {
+        // Flag is read before the ring, so values submitted before stop() are rendered.
+        const bool l_stopping = m_stopping.load(std::memory_order_acquire);
+        const size_t l_count = m_ring.popBatch(m_records);
+        if (l_count > 0) {
+            _render(l_count);
+            l_idle = 0;
+            continue;
+        }
+        if (l_stopping) {
+            return;
+        }
+        if (++l_idle < g_idle_spins) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(g_idle_sleep);
+        }
+    }
+}
+
+void tristan::date_time::TimestampRenderer::_render(size_t p_count) {
+    char* l_first = m_text.data();
+    char* const l_last = m_text.data() + m_text.size();
+    char* l_end = l_first;
+    for (size_t l_row = 0; l_row < p_count; ++l_row) {
+        m_tags[l_row] = m_records[l_row].tag;
+        m_offsets[l_row] = static_cast< uint32_t >(l_end - l_first);
+        // Values before 1900-01-01 or after 2155-12-31 are not representable and are rendered as empty rows, as are values which fail to format.
+        const auto l_date_time = m_records[l_row].time.toDateTime(tristan::time::Precision::NANOSECONDS, m_offset);
+        if (l_date_time) {
+            const auto l_result = m_spec.write(*l_date_time, l_end, l_last);
+            if (l_result.ec == std::errc{}) {
+                l_end = l_result.ptr;
+            }
+        }
+    }
+    m_offsets[p_count] = static_cast< uint32_t >(l_end - l_first);
+    m_sink(tristan::date_time::RenderedBatch{std::span< const uint64_t >(m_tags.data(), p_count),
+                                             std::span< const uint32_t >(m_offsets.data(), p_count + 1),
+                                             std::string_view(l_first, static_cast< size_t >(l_end - l_first))});
+}